@@ -0,0 +1,398 @@
+
+#include <cstring>
+
+#include "VCDBodyScanner.hpp"
+
+
+//! Whitespace separates tokens, other control characters are ignored too.
+static inline bool is_space(char c) {
+    return (unsigned char)c <= ' ';
+}
+
+
+//! Whether @p text is the digits of a binary vector, as BIN_NUM in the lexer.
+static bool is_binary(const char * text, size_t length) {
+    for(size_t i = 0; i < length; i ++) {
+        // Folds X and Z to lower case, no other non space character to a digit.
+        char c = text[i] | 0x20;
+        if(c != '0' && c != '1' && c != 'x' && c != 'z') {
+            return false;
+        }
+    }
+    return length > 0;
+}
+
+
+//! Number of decimal digits at the start of [p, end).
+static size_t count_digits(const char * p, const char * end) {
+    const char * q = p;
+    while(q < end && (unsigned)(*q - '0') <= 9) {
+        q ++;
+    }
+    return q - p;
+}
+
+
+//! Whether @p text is a real number, as REAL_NUM in the lexer.
+static bool is_real(const char * text, size_t length) {
+    const char * p   = text;
+    const char * end = text + length;
+
+    if(p < end && (*p == '+' || *p == '-')) {
+        p ++;
+    }
+
+    if(end - p == 3) {
+        char a = p[0] | 0x20, b = p[1] | 0x20, c = p[2] | 0x20;
+        if((a == 'i' && b == 'n' && c == 'f') || (a == 'n' && b == 'a' && c == 'n')) {
+            return true;
+        }
+    }
+
+    // Digits with an optional point, or a point and digits.
+    size_t whole = count_digits(p, end);
+    p += whole;
+    if(p < end && *p == '.') {
+        p ++;
+        size_t fraction = count_digits(p, end);
+        if(whole == 0 && fraction == 0) {
+            return false;
+        }
+        p += fraction;
+    } else if(whole == 0) {
+        return false;
+    }
+
+    if(p < end && (*p == 'e' || *p == 'E')) {
+        p ++;
+        if(p < end && (*p == '+' || *p == '-')) {
+            p ++;
+        }
+        size_t exponent = count_digits(p, end);
+        if(exponent == 0) {
+            return false;
+        }
+        p += exponent;
+    }
+
+    return p == end;
+}
+
+
+/*!
+*/
+VCDBodyScanner::VCDBodyScanner(){
+    this -> input   = nullptr;
+    this -> pos     = nullptr;
+    this -> limit   = nullptr;
+    this -> end     = nullptr;
+    this -> at_eof  = true;
+    this -> line    = 1;
+    this -> counted = nullptr;
+}
+
+
+/*!
+*/
+void VCDBodyScanner::reset(
+    const char * data,
+    size_t       size
+){
+    this -> input   = nullptr;
+    this -> buffer.clear();
+    this -> pos     = data;
+    this -> limit   = data + size;
+    this -> end     = data + size;
+    this -> at_eof  = true;
+    this -> line    = 1;
+    this -> counted = data;
+}
+
+
+/*!
+*/
+void VCDBodyScanner::reset(
+    VCDInput   * input,
+    const char * pending,
+    size_t       length,
+    size_t       buffer_size
+){
+    this -> input  = input;
+    this -> at_eof = false;
+
+    this -> buffer.resize(length > buffer_size ? length : buffer_size);
+    if(length > 0) {
+        std::memcpy(this -> buffer.data(), pending, length);
+    }
+
+    this -> pos = this -> buffer.data();
+    this -> end = this -> pos + length;
+    this -> set_limit(this -> pos);
+
+    this -> line    = 1;
+    this -> counted = this -> pos;
+}
+
+
+/*!
+*/
+void VCDBodyScanner::set_line(
+    const char * at,
+    size_t       line
+){
+    this -> counted = at;
+    this -> line    = line;
+}
+
+
+/*!
+*/
+size_t VCDBodyScanner::get_line(
+    const char * at
+) const {
+    size_t       line = this -> line;
+    const char * p    = this -> counted;
+
+    while(p < at && (p = (const char *)std::memchr(p, '\n', at - p))) {
+        p ++;
+        line ++;
+    }
+    return line;
+}
+
+
+/*!
+*/
+std::string VCDBodyScanner::syntax_error(
+    const VCDBodyToken & token
+) const {
+    return "syntax error, unexpected \"" + std::string(token.text, token.length) +
+           "\" on line " + std::to_string(this -> get_line(token.text));
+}
+
+
+/*!
+@details A word ending exactly at the end of the data read so far may
+continue in the next block, so only whole words before the last
+whitespace are made available until the stream is exhausted.
+*/
+void VCDBodyScanner::set_limit(const char * from){
+    if(this -> at_eof) {
+        this -> limit = this -> end;
+        return;
+    }
+
+    const char * p = this -> end;
+    while(p > from && !is_space(p[-1])) {
+        p --;
+    }
+    this -> limit = p;
+}
+
+
+/*!
+*/
+bool VCDBodyScanner::refill(
+    const char * & keep
+){
+    if(!this -> input || this -> at_eof) {
+        return false;
+    }
+
+    size_t kept = this -> end - keep;
+    char * base = this -> buffer.data();
+
+    // The lines of what is dropped are counted before it goes.
+    this -> line = this -> get_line(keep);
+
+    if(keep != base) {
+        std::memmove(base, keep, kept);
+    }
+
+    // A single token fills the whole buffer, make room for the rest of it.
+    if(kept == this -> buffer.size()) {
+        this -> buffer.resize(2 * this -> buffer.size());
+        base = this -> buffer.data();
+    }
+
+    size_t got = this -> input -> read(base + kept, this -> buffer.size() - kept);
+    if(got == 0) {
+        this -> at_eof = true;
+    }
+
+    keep            = base;
+    this -> pos     = base;
+    this -> counted = base;
+    this -> end     = base + kept + got;
+    this -> set_limit(base);
+
+    return true;
+}
+
+
+/*!
+*/
+bool VCDBodyScanner::word(
+    const char * & p,
+    const char * & text,
+    size_t       & length
+) const {
+    const char * q = p;
+
+    while(q < this -> limit && is_space(*q)) {
+        q ++;
+    }
+    if(q == this -> limit) {
+        p = q;
+        return false;
+    }
+
+    text = q;
+    while(q < this -> limit && !is_space(*q)) {
+        q ++;
+    }
+    length = q - text;
+    p = q;
+
+    return true;
+}
+
+
+/*!
+@details Each iteration of the loop scans one complete token. If the
+token is cut short by the end of the buffered data, more is read and the
+token scanned again from its start.
+*/
+bool VCDBodyScanner::next(
+    VCDBodyToken & token
+){
+    for(;;) {
+        const char * p = this -> pos;
+        const char * start;
+        size_t       length;
+
+        if(!this -> word(p, start, length)) {
+            if(this -> refill(p)) {
+                continue;
+            }
+            this -> pos = p;
+            return false;
+        }
+
+        bool complete = true;
+
+        token.text   = start + 1;
+        token.length = length - 1;
+
+        switch(start[0]) {
+
+            case '#': {
+                if(token.length == 0) {
+                    complete = this -> word(p, token.text, token.length);
+                    if(!complete) {
+                        break;
+                    }
+                }
+
+                VCDTime time = 0;
+                for(size_t i = 0; i < token.length; i ++) {
+                    unsigned d = (unsigned char)token.text[i] - '0';
+                    if(d > 9) {
+                        token.type = VCD_BODY_ERROR;
+                        token.text   = start;
+                        token.length = p - start;
+                        this -> pos  = p;
+                        return true;
+                    }
+                    time = time * 10 + d;
+                }
+
+                token.type = VCD_BODY_TIME;
+                token.time = time;
+                break;
+            }
+
+            case '0': case '1':
+            case 'x': case 'X':
+            case 'z': case 'Z':
+                switch(start[0]) {
+                    case '0':           token.bit = VCD_0; break;
+                    case '1':           token.bit = VCD_1; break;
+                    case 'z': case 'Z': token.bit = VCD_Z; break;
+                    default:            token.bit = VCD_X; break;
+                }
+
+                token.type = VCD_BODY_SCALAR;
+                if(length > 1) {
+                    token.code        = start + 1;
+                    token.code_length = length - 1;
+                } else {
+                    complete = this -> word(p, token.code, token.code_length);
+                }
+                break;
+
+            case 'b': case 'B':
+                token.type = VCD_BODY_VECTOR;
+                complete = this -> word(p, token.code, token.code_length);
+                if(complete && !is_binary(token.text, token.length)) {
+                    token.type   = VCD_BODY_ERROR;
+                    token.text   = start;
+                    token.length = length;
+                }
+                break;
+
+            case 'r': case 'R':
+                token.type = VCD_BODY_REAL;
+                complete = this -> word(p, token.code, token.code_length);
+                if(complete && !is_real(token.text, token.length)) {
+                    token.type   = VCD_BODY_ERROR;
+                    token.text   = start;
+                    token.length = length;
+                }
+                break;
+
+            case '$':
+                token.type   = VCD_BODY_COMMAND;
+                token.text   = start;
+                token.length = length;
+
+                if(length == 8 && std::memcmp(start, "$comment", 8) == 0) {
+                    const char * w;
+                    size_t       n;
+
+                    while((complete = this -> word(p, w, n))) {
+                        if(n == 4 && std::memcmp(w, "$end", 4) == 0) {
+                            break;
+                        }
+                    }
+                    if(complete) {
+                        this -> pos = p;
+                        continue;
+                    }
+                }
+                break;
+
+            default:
+                token.type   = VCD_BODY_ERROR;
+                token.text   = start;
+                token.length = length;
+                break;
+        }
+
+        if(!complete) {
+            if(this -> refill(start)) {
+                continue;
+            }
+
+            // The input ends part way through a token.
+            token.type   = VCD_BODY_ERROR;
+            token.text   = start;
+            token.length = this -> end - start;
+            this -> pos  = this -> end;
+            return true;
+        }
+
+        this -> pos = p;
+        return true;
+    }
+}
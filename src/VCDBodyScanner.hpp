@@ -0,0 +1,188 @@
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "VCDTypes.hpp"
+#include "VCDInput.hpp"
+
+/*!
+@file VCDBodyScanner.hpp
+@brief Hand written tokeniser for the value change section of a VCD file.
+*/
+
+#ifndef VCDBodyScanner_HPP
+#define VCDBodyScanner_HPP
+
+//! Kinds of token produced by VCDBodyScanner.
+typedef enum {
+    VCD_BODY_TIME,      //!< A #time, held in time.
+    VCD_BODY_SCALAR,    //!< A scalar change, held in bit.
+    VCD_BODY_VECTOR,    //!< A binary vector change, digits in text.
+    VCD_BODY_REAL,      //!< A real change, the number in text.
+    VCD_BODY_COMMAND,   //!< A keyword such as $dumpvars or $end, in text.
+    VCD_BODY_ERROR      //!< Malformed input, the offending token in text, see VCDBodyScanner::syntax_error().
+} VCDBodyTokenType;
+
+/*!
+@brief A single token of the value change section.
+@details text and code point into the buffer of the scanner, they are
+valid until the next call to VCDBodyScanner::next().
+*/
+struct VCDBodyToken {
+    VCDBodyTokenType type;        //!< What the token is.
+    VCDTime          time;        //!< Time of a VCD_BODY_TIME.
+    VCDBit           bit;         //!< Value of a VCD_BODY_SCALAR.
+    const char     * text;        //!< Digits, number or keyword, not terminated.
+    size_t           length;      //!< Number of characters in text.
+    const char     * code;        //!< Identifier code of a value change.
+    size_t           code_length; //!< Number of characters in code.
+};
+
+/*!
+@brief Splits the value change section of a VCD file into tokens.
+@details After $enddefinitions a VCD file holds only #time markers,
+value changes and a handful of keywords, all separated by whitespace.
+This scanner handles exactly that subset with a direct loop over the
+characters, in place of the flex DFA and bison grammar used for the
+header. Comments are skipped. Vector digits and real numbers are checked
+as the lexer checks them, and anything else is a VCD_BODY_ERROR.
+
+The section is either held entirely in memory, as for a memory mapped
+file, or read from a VCDInput in blocks. In the latter case a token which
+straddles two blocks is moved to the front of the buffer before the next
+block is read after it.
+
+Lines are counted from a point set by set_line(), only as far as needed:
+a section in memory is counted when an error is described, a stream as
+each block is read.
+*/
+class VCDBodyScanner {
+
+    public:
+
+        //! Bytes read from a stream at a time.
+        static const size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+        //! Create a scanner with no input.
+        VCDBodyScanner();
+
+        /*!
+        @brief Scan a value change section held in memory.
+        @param data in - The section, which must outlive the scanner.
+        @param size in - Number of bytes in @p data.
+        */
+        void reset(
+            const char * data,
+            size_t       size
+        );
+
+        /*!
+        @brief Scan a value change section read from a stream.
+        @param input in - The stream, positioned after @p pending.
+        @param pending in - Bytes already read from the stream, scanned
+        before anything else. They are copied.
+        @param length in - Number of bytes in @p pending.
+        @param buffer_size in - Bytes to read from @p input at a time.
+        */
+        void reset(
+            VCDInput   * input,
+            const char * pending,
+            size_t       length,
+            size_t       buffer_size = DEFAULT_BUFFER_SIZE
+        );
+
+        /*!
+        @brief Read the next token.
+        @returns false at the end of the input.
+        */
+        bool next(
+            VCDBodyToken & token
+        );
+
+        /*!
+        @brief Where scanning continues.
+        @details Just after the last token returned by next(), and before
+        any whitespace following it. Within the section held in memory
+        for a memory mapped file, within the buffer otherwise.
+        */
+        const char * get_position() const {
+            return this -> pos;
+        }
+
+        /*!
+        @brief Say which line the character at @p at is on.
+        @details Lines are counted on from there. @p at may be before the
+        start of a section held in memory, as long as the characters in
+        between are too, such as the start of a memory mapped file. The
+        line is 1 at the start of the section otherwise.
+        */
+        void set_line(
+            const char * at,
+            size_t       line
+        );
+
+        //! The line of the character at @p at, at or after set_line().
+        size_t get_line(
+            const char * at
+        ) const;
+
+        /*!
+        @brief Describe a VCD_BODY_ERROR token from the last call to next().
+        @returns A message giving the offending token and its line.
+        */
+        std::string syntax_error(
+            const VCDBodyToken & token
+        ) const;
+
+    protected:
+
+        //! Stream to read more input from, nullptr when scanning memory.
+        VCDInput        * input;
+
+        //! Buffered input of a stream.
+        std::vector<char> buffer;
+
+        //! Next character to scan.
+        const char      * pos;
+
+        //! End of the characters which may be scanned without reading more.
+        const char      * limit;
+
+        //! End of the characters read so far.
+        const char      * end;
+
+        //! Whether the stream has no more to read.
+        bool              at_eof;
+
+        //! Line of the character at counted.
+        size_t            line;
+
+        //! Where counting lines continues, at or before pos.
+        const char      * counted;
+
+        /*!
+        @brief Read the next whitespace delimited word.
+        @returns false if no complete word is available before limit.
+        */
+        bool word(
+            const char * & p,
+            const char * & text,
+            size_t       & length
+        ) const;
+
+        /*!
+        @brief Read more of the stream, keeping everything from @p keep.
+        @details Moves the kept characters to the front of the buffer,
+        updating @p keep, and sets pos to it.
+        @returns false if there is nothing more to read.
+        */
+        bool refill(
+            const char * & keep
+        );
+
+        //! Find the end of the complete words in [from, end).
+        void set_limit(const char * from);
+};
+
+#endif
@@ -0,0 +1,89 @@
+
+#include <cstddef>
+
+#include "VCDTypes.hpp"
+#include "VCDValue.hpp"
+
+/*!
+@file VCDEventHandler.hpp
+@brief Callback interface for streaming through a VCD file.
+*/
+
+#ifndef VCDEventHandler_HPP
+#define VCDEventHandler_HPP
+
+class VCDFile;
+
+/*!
+@brief Receives the contents of a VCD file as it is parsed.
+@details Pass an implementation to VCDFileParser::parse_events() to see
+every declaration and value change in file order, without the value
+changes being stored. Memory use then depends on the number of signals
+only, not on the length of the trace.
+
+Every method does nothing by default, so handlers only override what they
+need. Objects passed by reference are owned by the parser and only valid
+during the call, except scopes and signals which live until
+parse_events() returns.
+*/
+class VCDEventHandler {
+
+    public:
+
+        virtual ~VCDEventHandler() {}
+
+        //! A $scope has been entered.
+        virtual void on_scope(const VCDScope & scope) {
+            (void)scope;
+        }
+
+        //! The innermost $scope has been left.
+        virtual void on_upscope(const VCDScope & scope) {
+            (void)scope;
+        }
+
+        /*!
+        @brief A $var has been declared.
+        @details signal.id identifies the signal in the value change
+        callbacks. Signals sharing an identifier code share an id.
+        */
+        virtual void on_var(const VCDSignal & signal) {
+            (void)signal;
+        }
+
+        /*!
+        @brief $enddefinitions has been reached.
+        @param header in - The scopes, signals, timescale and header
+        strings of the file. It holds no value changes.
+        */
+        virtual void on_enddefinitions(const VCDFile & header) {
+            (void)header;
+        }
+
+        //! A #time marker at or after VCDFileParser::start_time.
+        virtual void on_time(VCDTime time) {
+            (void)time;
+        }
+
+        //! A scalar value change.
+        virtual void on_scalar(VCDTime time, VCDSignalId id, VCDBit value) {
+            (void)time; (void)id; (void)value;
+        }
+
+        /*!
+        @brief A binary vector value change.
+        @param value in - The change decoded to the declared width of the
+        signal. Wide values refer to a buffer of the parser.
+        */
+        virtual void on_vector(VCDTime time, VCDSignalId id,
+                               const VCDValue & value) {
+            (void)time; (void)id; (void)value;
+        }
+
+        //! A real value change.
+        virtual void on_real(VCDTime time, VCDSignalId id, VCDReal value) {
+            (void)time; (void)id; (void)value;
+        }
+};
+
+#endif
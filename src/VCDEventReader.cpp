@@ -0,0 +1,246 @@
+
+#include <algorithm>
+#include <limits>
+
+#include "VCDEventReader.hpp"
+
+
+/*!
+@brief Target of the value change rules which records into one event.
+@details Each rule applied records at most one event, so next() applies
+tokens until produced is set.
+*/
+struct VCDEventCapture {
+
+    VCDEventCapture(VCDEvent & event, const VCDFile & file, uint64_t * planes)
+        : event(event), file(file), planes(planes), produced(false) {}
+
+    VCDEvent       & event;
+    const VCDFile  & file;
+    uint64_t       * planes;
+    bool             produced;
+
+    void add_timestamp(VCDTime time) {
+        event.type = VCD_EVENT_TIME;
+        event.time = time;
+        produced   = true;
+    }
+
+    void add_signal_value(VCDSignalId id, VCDTime time, VCDBit value) {
+        event.type = VCD_EVENT_SCALAR;
+        event.time = time;
+        event.id   = id;
+        event.bit  = value;
+        produced   = true;
+    }
+
+    void add_signal_value(VCDSignalId id, VCDTime time,
+                          const char * digits, size_t length) {
+        VCDSignalSize width = file.get_signal_values(id) -> get_width();
+
+        VCDValue::decode_binary(digits, length, width, planes);
+
+        event.type   = VCD_EVENT_VECTOR;
+        event.time   = time;
+        event.id     = id;
+        event.width  = width;
+        event.planes = planes;
+        produced     = true;
+    }
+
+    void add_signal_value(VCDSignalId id, VCDTime time, VCDReal value) {
+        event.type = VCD_EVENT_REAL;
+        event.time = time;
+        event.id   = id;
+        event.real = value;
+        produced   = true;
+    }
+};
+
+
+/*!
+*/
+VCDEventReader::VCDEventReader(){
+    this -> header    = nullptr;
+    this -> now       = 0;
+    this -> reading   = false;
+    this -> error     = false;
+    this -> replaying = false;
+    this -> replay    = 0;
+}
+
+
+/*!
+*/
+VCDEventReader::~VCDEventReader(){
+    this -> close();
+}
+
+
+/*!
+@details The header is parsed by the grammar as for parse_file(), which
+stops at $enddefinitions. The vector buffer is then sized for the widest
+signal, so next() never has to grow it.
+*/
+bool VCDEventReader::open(
+    const std::string & filepath
+){
+    this -> close();
+
+    this -> parser.handler = nullptr;
+
+    if(!this -> parser.begin_parse(filepath)) {
+        this -> parser.end_parse();
+        delete this -> parser.fh;
+        this -> parser.fh = nullptr;
+        return false;
+    }
+
+    this -> header = this -> parser.fh;
+    this -> now    = this -> parser.current_time;
+    this -> error  = false;
+
+    size_t words = 2;
+    for(size_t id = 0; id < this -> header -> get_signal_id_count(); id ++) {
+        VCDSignalSize width =
+            this -> header -> get_signal_values((VCDSignalId)id) -> get_width();
+        words = std::max<size_t>(words, 2 * VCDValue::words_for_width(width));
+    }
+    this -> planes.assign(words, 0);
+
+    // Without $enddefinitions the grammar has already read everything.
+    if(this -> parser.end_of_header) {
+        this -> parser.begin_body(this -> body);
+        this -> reading = true;
+
+        if(this -> parser.start_time != std::numeric_limits<VCDTime>::min()) {
+            this -> skip();
+        }
+    } else if(!this -> parser.end_parse()) {
+        this -> error = true;
+    }
+
+    return true;
+}
+
+
+/*!
+@details As in VCDFileParser::parse_body(), nothing is decoded while
+skipping. next() then returns what apply_skipped() would apply.
+*/
+void VCDEventReader::skip(){
+    VCDBodyToken none;
+    none.type = VCD_BODY_COMMAND;
+
+    bool mapped = this -> parser.input.is_mapped();
+
+    this -> state.assign(this -> header -> get_signal_id_count(), none);
+    this -> copies.clear();
+    if(!mapped) {
+        this -> copies.resize(this -> state.size());
+    }
+
+    std::string message;
+
+    if(!this -> parser.skip_body(this -> body, this -> now, this -> state,
+                                 mapped ? nullptr : &this -> copies,
+                                 this -> marker, message)) {
+        this -> parser.error(message);
+        this -> error = true;
+        this -> finish();
+        return;
+    }
+
+    // Nothing is left at or after start_time.
+    if(this -> marker.type != VCD_BODY_TIME) {
+        this -> finish();
+        return;
+    }
+
+    this -> replaying = true;
+    this -> replay    = 0;
+}
+
+
+/*!
+*/
+bool VCDEventReader::next(
+    VCDEvent & event
+){
+    if(!this -> reading) {
+        return false;
+    }
+
+    VCDEventCapture capture(event, *this -> header, this -> planes.data());
+    VCDBodyToken    token;
+
+    // What skip() kept, one step of apply_skipped() at a time.
+    while(this -> replaying && !capture.produced) {
+        VCDTime start = this -> parser.start_time;
+        size_t  step  = this -> replay ++;
+
+        if(step == 0) {
+            if(!this -> parser.apply_time(capture, this -> now, start)) {
+                this -> finish();
+                return false;
+            }
+        } else if(step <= this -> state.size()) {
+            this -> parser.apply_state(capture, (VCDSignalId)(step - 1),
+                                       this -> state[step - 1]);
+        } else {
+            this -> replaying = false;
+            if(this -> marker.time != start &&
+               !this -> parser.apply_time(capture, this -> now, this -> marker.time)) {
+                this -> finish();
+                return false;
+            }
+        }
+    }
+
+    while(!capture.produced) {
+        if(!this -> body.next(token)) {
+            this -> finish();
+            return false;
+        }
+
+        if(token.type == VCD_BODY_ERROR) {
+            this -> parser.error(this -> body.syntax_error(token));
+            this -> error = true;
+            this -> finish();
+            return false;
+        }
+
+        if(!this -> parser.apply_token(capture, this -> now, token)) {
+            this -> finish();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*!
+*/
+void VCDEventReader::finish(){
+    this -> replaying = false;
+
+    if(this -> reading) {
+        this -> reading = false;
+        this -> body.reset(nullptr, 0);
+        if(!this -> parser.end_parse()) {
+            this -> error = true;
+        }
+    }
+}
+
+
+/*!
+*/
+void VCDEventReader::close(){
+    this -> finish();
+
+    delete this -> header;
+    this -> header    = nullptr;
+    this -> parser.fh = nullptr;
+}
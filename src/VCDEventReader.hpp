@@ -0,0 +1,171 @@
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "VCDTypes.hpp"
+#include "VCDValue.hpp"
+#include "VCDFile.hpp"
+#include "VCDFileParser.hpp"
+#include "VCDBodyScanner.hpp"
+
+/*!
+@file VCDEventReader.hpp
+@brief Pull interface for reading a VCD file one event at a time.
+*/
+
+#ifndef VCDEventReader_HPP
+#define VCDEventReader_HPP
+
+//! Kinds of event returned by VCDEventReader::next().
+typedef enum {
+    VCD_EVENT_TIME,     //!< A #time marker.
+    VCD_EVENT_SCALAR,   //!< A scalar value change, held in bit.
+    VCD_EVENT_VECTOR,   //!< A binary vector value change, held in planes.
+    VCD_EVENT_REAL      //!< A real value change, held in real.
+} VCDEventType;
+
+/*!
+@brief A single time marker or value change.
+@details Filled in by VCDEventReader::next(). Only the fields for the
+type of the event are set.
+*/
+struct VCDEvent {
+    VCDEventType     type;   //!< What the event is.
+    VCDTime          time;   //!< The time marker, or time of the change.
+    VCDSignalId      id;     //!< Signal of a value change.
+    VCDBit           bit;    //!< Value of a VCD_EVENT_SCALAR.
+    VCDReal          real;   //!< Value of a VCD_EVENT_REAL.
+    VCDSignalSize    width;  //!< Declared width of a VCD_EVENT_VECTOR.
+
+    /*!
+    @brief Bit-planes of a VCD_EVENT_VECTOR, decoded to width.
+    @details Points into a buffer of the reader which is overwritten by
+    the next call to VCDEventReader::next().
+    */
+    const uint64_t * planes;
+
+    /*!
+    @brief The value of a change as a VCDValue.
+    @details Vectors wider than 64 bits refer to planes rather than
+    copying them.
+    */
+    VCDValue get_value() const {
+        switch(this -> type) {
+            case VCD_EVENT_SCALAR: return VCDValue(this -> bit);
+            case VCD_EVENT_REAL:   return VCDValue(this -> real);
+            default:               return VCDValue(this -> width, this -> planes);
+        }
+    }
+};
+
+/*!
+@brief Reads the value changes of a VCD file on demand.
+@details The pull counterpart of VCDFileParser::parse_events(). open()
+parses the header, after which each call to next() scans just far
+enough to return the next event. Control stays with the caller, so
+several files can be read in lockstep, for instance to compare two
+traces, and reading can be stopped at any point.
+
+Nothing is allocated per event: vectors are decoded into a buffer sized
+for the widest signal when the file is opened.
+
+start_time, end_time, use_mmap and the signal selection are taken from
+parser, and should be set before open(). As for parse_file(), the value
+changes before start_time are skipped when the file is opened, and the
+first events are a time event at start_time followed by the last value
+of each signal before it.
+*/
+class VCDEventReader {
+
+    public:
+
+        //! Create a reader with no file open.
+        VCDEventReader();
+
+        //! Closes the file and releases the header.
+        virtual ~VCDEventReader();
+
+        //! Options of the parse, and the parser of the header.
+        VCDFileParser parser;
+
+        /*!
+        @brief Open a file and parse its header.
+        @details Any file already open is closed first.
+        @param filepath in - The file to read, or "-" for stdin.
+        @returns false if the header is malformed.
+        */
+        bool open(const std::string & filepath);
+
+        /*!
+        @brief Read the next event.
+        @param event out - Filled in with the event.
+        @returns false once the file has been read to the end or past
+        end_time, or on a syntax error.
+        */
+        bool next(VCDEvent & event);
+
+        //! Close the file and release the header.
+        void close();
+
+        /*!
+        @brief The scopes, signals and header strings of the open file.
+        @details Signal ids in events refer to this file. It holds no
+        value changes. nullptr if no file is open.
+        */
+        const VCDFile * get_header() const {
+            return this -> header;
+        }
+
+        //! Whether reading stopped on a syntax error.
+        bool failed() const {
+            return this -> error;
+        }
+
+    protected:
+
+        //! Scopes and signals of the open file.
+        VCDFile             * header;
+
+        //! Scans the value changes of the open file.
+        VCDBodyScanner        body;
+
+        //! Time of the value changes being read.
+        VCDTime               now;
+
+        //! Whether next() may return further events.
+        bool                  reading;
+
+        //! Set on a syntax error.
+        bool                  error;
+
+        //! Bit-planes of the last vector event.
+        std::vector<uint64_t> planes;
+
+        //! Last change of each signal before start_time, see VCDFileParser::skip_body().
+        std::vector<VCDBodyToken> state;
+
+        //! Text of the changes in state, for a stream whose buffer is reused.
+        std::vector<std::string> copies;
+
+        //! The #time marker at which skipping stopped.
+        VCDBodyToken          marker;
+
+        //! Whether next() is still returning what was skipped.
+        bool                  replaying;
+
+        /*!
+        @brief Next step of the replay: 0 for start_time, 1 + id for the
+        state of signal id, and then the marker.
+        */
+        size_t                replay;
+
+        //! Skip the value changes before start_time, for next() to replay.
+        void skip();
+
+        //! Stop reading and close the input, keeping the header.
+        void finish();
+};
+
+#endif
@@ -2,11 +2,21 @@
 #include <iostream>
 
 #include "VCDFile.hpp"
+#include "VCDFileCache.hpp"
+#include "VCDSignalLoader.hpp"
         
         
 //! Instance a new VCD file container.
 VCDFile::VCDFile(){
 
+    // Used when the file has no $timescale.
+    this -> time_units      = TIME_S;
+    this -> time_resolution = 1;
+
+    this -> cache           = nullptr;
+    this -> loader          = nullptr;
+    this -> times_borrowed  = false;
+
 }
         
 //! Destructor
@@ -25,21 +35,15 @@ VCDFile::~VCDFile(){
 
     // Delete signal values.
     
-    for(auto hash_val = this -> val_map.begin();
-             hash_val != this -> val_map.end();
-             ++hash_val)
-    {
-        for(auto vals = hash_val -> second -> begin();
-                 vals != hash_val -> second -> end();
-                 ++vals)
-        {
-            delete (*vals) -> value;
-            delete *vals;
-        }
-
-        delete hash_val -> second;
+    for(VCDSignalValues * vals : this -> val_map) {
+        delete vals;
     }
 
+    // Only once nothing refers to it.
+    delete this -> cache;
+
+    delete this -> loader;
+
 }
 
 
@@ -62,10 +66,41 @@ void VCDFile::add_signal(
     this -> signals.push_back(s);
 
     // Add a timestream entry
-    if(val_map.find(s -> hash) == val_map.end()) {
+    VCDSignalId id = this -> get_signal_id(s -> hash);
+
+    if(id == VCD_SIGNAL_ID_NONE) {
         // Values will be populated later.
-        val_map[s -> hash] = new VCDSignalValues();
+        // The first declaration of a hash decides how its values are kept.
+        VCDValueType type = VCD_SCALAR;
+
+        if(s -> type == VCD_VAR_REAL || s -> type == VCD_VAR_REALTIME) {
+            type = VCD_REAL;
+        } else if(s -> size > 1) {
+            type = VCD_VECTOR;
+        }
+
+        id = (VCDSignalId)this -> val_map.size();
+        this -> id_map.insert(s -> hash.data(), s -> hash.size(), id);
+        this -> val_map.push_back(new VCDSignalValues(type, s -> size));
     }
+
+    s -> id = id;
+}
+
+
+/*!
+*/
+VCDSignalId VCDFile::get_signal_id(
+    const VCDSignalHash & hash
+) const {
+    return this -> id_map.find(hash.data(), hash.size());
+}
+
+
+/*!
+*/
+size_t VCDFile::get_signal_id_count() const {
+    return this -> val_map.size();
 }
 
 
@@ -82,23 +117,73 @@ VCDScope *VCDFile::get_scope(VCDScopeName name) {
 
 
 /*!
-@brief Add a new signal value to the VCD file, tagged by time.
+@brief Add a new scalar value change to the VCD file.
+*/
+void VCDFile::add_signal_value(
+    VCDSignalId id,
+    VCDTime     time,
+    VCDBit      value
+){
+    this -> val_map[id] -> append_scalar(time, value);
+}
+
+
+/*!
+@brief Add a new vector value change to the VCD file.
+*/
+void VCDFile::add_signal_value(
+    VCDSignalId  id,
+    VCDTime      time,
+    const char * digits,
+    size_t       length
+){
+    this -> val_map[id] -> append_vector(time, digits, length);
+}
+
+
+/*!
+@brief Add a new real value change to the VCD file.
 */
 void VCDFile::add_signal_value(
-    VCDTimedValue * time_val,
-    VCDSignalHash   hash
+    VCDSignalId id,
+    VCDTime     time,
+    VCDReal     value
 ){
-    this -> val_map[hash] -> push_back(time_val);
+    this -> val_map[id] -> append_real(time, value);
 }
 
 
 /*!
 */
 std::vector<VCDTime>* VCDFile::get_timestamps(){
+    this -> own_timestamps();
     return &this -> times;
 }
 
 
+/*!
+*/
+VCDSpan<VCDTime> VCDFile::get_timestamp_view() const {
+    if(this -> times_borrowed) {
+        return this -> cached_times;
+    }
+    return VCDSpan<VCDTime>(this -> times.data(), this -> times.size());
+}
+
+
+/*!
+*/
+void VCDFile::own_timestamps(){
+    if(!this -> times_borrowed) {
+        return;
+    }
+
+    this -> times.assign(this -> cached_times.begin(), this -> cached_times.end());
+    this -> cached_times   = VCDSpan<VCDTime>();
+    this -> times_borrowed = false;
+}
+
+
 /*!
 */
 std::vector<VCDScope*>* VCDFile::get_scopes(){
@@ -113,65 +198,153 @@ std::vector<VCDSignal*>* VCDFile::get_signals(){
 }
 
 
+/*!
+*/
+double VCDFile::get_time_seconds(
+    VCDTime time
+) const {
+    static const double unit_seconds[] = {
+        1e0,    // TIME_S
+        1e-3,   // TIME_MS
+        1e-6,   // TIME_US
+        1e-9,   // TIME_NS
+        1e-12,  // TIME_PS
+        1e-15   // TIME_FS
+    };
+
+    return (double)time * this -> time_resolution
+                        * unit_seconds[this -> time_units];
+}
+
+
 /*!
 */
 void VCDFile::add_timestamp(
     VCDTime time
 ){
+    this -> own_timestamps();
     this -> times.push_back(time);
 }
 
+/*!
+*/
+bool VCDFile::get_signal_value_at (
+    const VCDSignalHash& hash,
+    VCDTime       time,
+    VCDValue    & value
+) const {
+    return this -> get_signal_value_at(
+        this -> get_signal_id(hash), time, value);
+}
+
 /*!
 */
 VCDValue * VCDFile::get_signal_value_at (
     const VCDSignalHash& hash,
     VCDTime       time,
-    bool erase_prior
+    bool          erase_prior
 ){
-    auto find = val_map.find(hash); 
-    if(find == this -> val_map.end()) {
+    (void)erase_prior;
+
+    if(!this -> get_signal_value_at(hash, time, this -> legacy_value)) {
         return nullptr;
     }
-    
-    VCDSignalValues * vals = find->second;
+    return &this -> legacy_value;
+}
 
-    if(vals -> size() == 0) {
-        return nullptr;
+/*!
+*/
+bool VCDFile::get_signal_value_at (
+    VCDSignalId   id,
+    VCDTime       time,
+    VCDValue    & value
+) const {
+    const VCDSignalValues * vals = this -> get_signal_values(id);
+
+    if(vals == nullptr) {
+        return false;
     }
 
-    VCDSignalValues::iterator erase_until = vals->begin();
+    size_t count = vals -> upper_bound(time);
 
-    VCDValue * tr = nullptr;
+    if(count == 0) {
+        return false;
+    }
 
-    for(auto it = vals -> begin();
-             it != vals -> end();
-             ++ it) {
+    value = vals -> get_value(count - 1);
 
-        if((*it) -> time <= time) {
-            erase_until = it;
-            tr = (*it) -> value;
-        } else {
-            break;
-        }
+    return true;
+}
+
+/*!
+*/
+size_t VCDFile::get_signal_values_at (
+    VCDSignalId                  id,
+    const std::vector<VCDTime> & times,
+    std::vector<VCDValue>      & values
+) const {
+    values.assign(times.size(), VCDValue());
+
+    const VCDSignalValues * vals = this -> get_signal_values(id);
+
+    if(vals == nullptr) {
+        return times.size();
     }
 
-    if (erase_prior) {
-        // avoid O(n^2) performance for large sequential scans
-        for (auto i = vals->begin() ; i != erase_until; i++) {
-            delete (*i) -> value;
+    size_t missing = 0;
+    size_t count   = 0;
+
+    for(size_t i = 0; i < times.size(); i ++) {
+        count = vals -> upper_bound(times[i], count);
+
+        if(count == 0) {
+            missing ++;
+        } else {
+            values[i] = vals -> get_value(count - 1);
         }
-        vals->erase(vals->begin(), erase_until);
     }
 
-    return tr;
+    return missing;
 }
 
 VCDSignalValues * VCDFile::get_signal_values (
     VCDSignalHash hash
 ){
-    if(this -> val_map.find(hash) == this -> val_map.end()) {
+    return this -> get_signal_values(this -> get_signal_id(hash));
+}
+
+VCDSignalValues * VCDFile::get_signal_values (
+    VCDSignalId id
+){
+    if(id >= this -> val_map.size()) {
         return nullptr;
     }
 
-    return this -> val_map[hash];
+    if(this -> loader) {
+        this -> loader -> load(id);
+    }
+
+    return this -> val_map[id];
+}
+
+const VCDSignalValues * VCDFile::get_signal_values (
+    VCDSignalId id
+) const {
+    if(id >= this -> val_map.size()) {
+        return nullptr;
+    }
+
+    if(this -> loader) {
+        this -> loader -> load(id);
+    }
+
+    return this -> val_map[id];
+}
+
+void VCDFile::load_signal_values (
+    const std::vector<VCDSignalId> & ids
+) const {
+    if(this -> loader) {
+        this -> loader -> load(ids);
+    }
 }
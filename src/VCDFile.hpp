@@ -5,10 +5,15 @@
 
 #include "VCDTypes.hpp"
 #include "VCDValue.hpp"
+#include "VCDIdCodeTable.hpp"
+#include "VCDSignalValues.hpp"
 
 #ifndef VCDFile_HPP
 #define VCDFile_HPP
 
+class VCDFileCache;
+class VCDSignalLoader;
+
 
 /*!
 @brief Top level object to represent a single VCD file.
@@ -28,6 +33,16 @@ class VCDFile {
 
         //! Multiplier of the VCD file time units.
         VCDTimeRes  time_resolution;
+
+        /*!
+        @brief Convert a time of this file into seconds.
+        @details Scales by the $timescale of the file, e.g. 1500 in a
+        10ps file is 1.5e-8 seconds.
+        @param time in - A timestamp in units of the file timescale.
+        */
+        double get_time_seconds(
+            VCDTime time
+        ) const;
         
         //! Date string of the VCD file.
         std::string date;
@@ -51,6 +66,7 @@ class VCDFile {
 
         /*!
         @brief Add a new signal to the VCD file
+        @details Assigns s -> id. Signals sharing a hash share an id.
         @param s in - The VCDSignal object to add to the VCD file.
         */
         void add_signal(
@@ -79,13 +95,67 @@ class VCDFile {
 
 
         /*!
-        @brief Add a new signal value to the VCD file, tagged by time.
-        @param time_val in - A signal value, tagged by the time it occurs.
-        @param hash in - The VCD hash value representing the signal.
+        @brief Return the dense index assigned to a signal hash.
+        @returns The id, or VCD_SIGNAL_ID_NONE if the hash was never declared.
+        */
+        VCDSignalId get_signal_id(
+            const VCDSignalHash & hash
+        ) const;
+
+        /*!
+        @brief Return the dense index assigned to an identifier code.
+        @details Used by the scanner to resolve codes in place, without
+        building a string.
+        @param code in - The identifier code characters.
+        @param length in - The number of characters in the code.
+        @returns The id, or VCD_SIGNAL_ID_NONE if the code was never declared.
+        */
+        VCDSignalId get_signal_id(
+            const char * code,
+            size_t       length
+        ) const {
+            return this -> id_map.find(code, length);
+        }
+
+        //! Number of distinct signal ids, ids run from 0 to this - 1.
+        size_t get_signal_id_count() const;
+
+        /*!
+        @brief Add a new scalar value change to the VCD file.
+        @param id in - The id of the signal, as returned by get_signal_id().
+        @param time in - The time at which the change occurs.
+        @param value in - The new value of the signal.
         */
         void add_signal_value(
-            VCDTimedValue * time_val,
-            VCDSignalHash   hash
+            VCDSignalId id,
+            VCDTime     time,
+            VCDBit      value
+        );
+
+        /*!
+        @brief Add a new vector value change to the VCD file.
+        @param id in - The id of the signal, as returned by get_signal_id().
+        @param time in - The time at which the change occurs.
+        @param digits in - Binary digits of the value, most significant first.
+        @param length in - Number of digits.
+        */
+        void add_signal_value(
+            VCDSignalId  id,
+            VCDTime      time,
+            const char * digits,
+            size_t       length
+        );
+
+        /*!
+        @brief Add a new real value change to the VCD file.
+        @param id in - The id of the signal, as returned by get_signal_id().
+        @param time in - The time at which the change occurs.
+        @param value in - The new value of the signal.
+        */
+        void add_signal_value(
+            VCDSignalId id,
+            VCDTime     time,
+            VCDReal     value
         );
         
 
@@ -93,32 +163,131 @@ class VCDFile {
         @brief Get the value of a particular signal at a specified time.
         @note The supplied time value does not need to exist in the
         vector returned by get_timestamps().
+        @details O(log n) in the length of the history of the signal. The
+        file is not modified, so any number of threads may query a parsed
+        file concurrently. A file from VCDFileParser::parse_lazy() loads
+        the history first if need be, see VCDSignalLoader, which may evict
+        histories other threads are reading, so it should only be queried
+        from one thread at a time.
+        @param hash in - The hashcode for the signal to identify it.
+        @param time in - The time at which we want the value of the signal.
+        @param value out - The value at the supplied time. It is a copy,
+        so vectors wider than 64 bits own their bit-planes and stay valid
+        after the history changes or is evicted.
+        @returns true if a value was found, false if the signal is unknown
+        or had no value at that time.
+        */
+        bool get_signal_value_at (
+            const VCDSignalHash& hash,
+            VCDTime       time,
+            VCDValue    & value
+        ) const;
+
+        /*!
+        @brief Get the value of a particular signal at a specified time, as
+        releases before the columnar histories did.
+        @deprecated Use the overload filling a VCDValue, which is const and
+        may be called from several threads at once.
         @param hash in - The hashcode for the signal to identify it.
         @param time in - The time at which we want the value of the signal.
-        @param erase_prior in - Erase signals prior to this time. Avoids O(n^2) searching times when scanning large .vcd files sequentially.
-        @returns A pointer to the value at the supplie time, or nullptr if
-        no such record can be found.
+        @param erase_prior in - Ignored. Lookups no longer scan the history,
+        so nothing needs erasing to keep sequential scans fast.
+        @returns A pointer to a copy of the value, owned by the file and
+        overwritten by the next call, or nullptr if no such record can be
+        found.
         */
+        VCD_DEPRECATED("use get_signal_value_at(hash, time, value)")
         VCDValue * get_signal_value_at (
             const VCDSignalHash& hash,
             VCDTime       time,
-            bool erase_prior = false
+            bool          erase_prior = false
         );
 
         /*!
-        @brief Get a vector of VCD time values
+        @brief Get the value of a particular signal at a specified time.
+        @param id in - The id of the signal, as returned by get_signal_id().
+        @param time in - The time at which we want the value of the signal.
+        @param value out - The value at the supplied time.
+        @returns true if a value was found, false if the signal is unknown
+        or had no value at that time.
+        */
+        bool get_signal_value_at (
+            VCDSignalId   id,
+            VCDTime       time,
+            VCDValue    & value
+        ) const;
+
+        /*!
+        @brief Get the values of a signal at many points in time.
+        @details Walks the history once, in step with the sorted query
+        times, rather than searching it once per query.
+        @param id in - The id of the signal, as returned by get_signal_id().
+        @param times in - The query times, sorted ascending.
+        @param values out - Resized to times.size(), entry i holds the value
+        at times[i].
+        @returns The number of leading query times at which the signal had
+        no value yet. Their entries in @p values are default constructed.
+        */
+        size_t get_signal_values_at (
+            VCDSignalId                  id,
+            const std::vector<VCDTime> & times,
+            std::vector<VCDValue>      & values
+        ) const;
+
+        /*!
+        @brief Get the history of times and values of a signal
         @param hash in - The hashcode for the signal to identify it.
-        @returns A pointer to the vector of time values, or nullptr if hash not found
+        @returns A pointer to the history, or nullptr if hash not found
         */
         VCDSignalValues * get_signal_values (
             VCDSignalHash hash
         );
+
+        /*!
+        @brief Get the history of times and values of a signal
+        @details For a file from VCDFileParser::parse_lazy(), the history
+        is loaded if it is not, and may be emptied again by later loads of
+        other signals.
+        @param id in - The id of the signal, as returned by get_signal_id().
+        @returns A pointer to the history, or nullptr if id is out of range.
+        */
+        VCDSignalValues * get_signal_values (
+            VCDSignalId id
+        );
+
+        //! Get the history of times and values of a signal
+        const VCDSignalValues * get_signal_values (
+            VCDSignalId id
+        ) const;
+
+        /*!
+        @brief Load the histories of several signals at once.
+        @details For a file from VCDFileParser::parse_lazy(), loads those
+        of @p ids which are not loaded with a single scan of the value
+        changes, rather than one scan each as get_signal_values() would.
+        Does nothing for other files, which hold every history already.
+        @param ids in - Ids of signals, as returned by get_signal_id().
+        */
+        void load_signal_values (
+            const std::vector<VCDSignalId> & ids
+        ) const;
         
         /*!
         @brief Return a pointer to the set of timestamp samples present in
                the VCD file.
+        @details A file loaded by VCDFileCache copies its timestamps out
+        of the cache on the first call, see get_timestamp_view().
         */
         std::vector<VCDTime>* get_timestamps();
+
+        /*!
+        @brief The timestamps of the file, sorted ascending, without
+        copying them.
+        @details For a file loaded by VCDFileCache they refer to the
+        mapped cache until get_timestamps() or add_timestamp() copies
+        them. The view is invalidated by either.
+        */
+        VCDSpan<VCDTime> get_timestamp_view() const;
         
         /*!
         @brief Get a vector of all scopes present in the file.
@@ -141,8 +310,33 @@ class VCDFile {
         //! Vector of time values present in the VCD file - sorted, asc
         std::vector<VCDTime>    times;
 
-        //! Map of hashes onto vectors of times and signal values.
-        std::map<VCDSignalHash, VCDSignalValues*> val_map;
+        //! The timestamps in a loaded cache, used instead of times if borrowed.
+        VCDSpan<VCDTime>        cached_times;
+
+        //! Whether the timestamps are cached_times rather than times.
+        bool                    times_borrowed;
+
+        //! Map of hashes onto dense signal ids.
+        VCDIdCodeTable          id_map;
+
+        //! Times and signal values of each signal, indexed by signal id.
+        std::vector<VCDSignalValues*> val_map;
+
+        //! The cache the histories refer to, if the file was loaded from one.
+        VCDFileCache          * cache;
+
+        //! Loads histories on demand, if the file was parsed lazily.
+        VCDSignalLoader       * loader;
+
+        //! The value returned by the deprecated get_signal_value_at().
+        VCDValue                legacy_value;
+
+        //! Copy borrowed timestamps into times before they change.
+        void own_timestamps();
+
+        friend class VCDFileCache;
+        friend class VCDFileParser;
+        friend class VCDSignalLoader;
 };
 
 
@@ -0,0 +1,661 @@
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+
+#include <sys/stat.h>
+
+#include "VCDFile.hpp"
+#include "VCDFileCache.hpp"
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#define VCD_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+/*
+The layout of a cache file. Every record and column starts at a multiple
+of 8 bytes, and all offsets are from the start of the file.
+
+    CacheHeader
+    CacheScope   scopes[scope_count]
+    CacheSignal  signals[signal_count]
+    CacheHistory histories[history_count]
+    char         text[]                     names and header strings
+    VCDTime      times[time_count]
+    for each history:
+        VCDTime  times[count]
+        uint8_t  scalars[count]            or
+        uint64_t words[count * stride]     or
+        VCDReal  reals[count]
+*/
+
+static const char     CACHE_MAGIC[8]   = {'V','C','D','C','A','C','H','E'};
+static const uint32_t CACHE_VERSION    = 1;
+static const uint32_t CACHE_BYTE_ORDER = 0x01020304;
+
+//! Index used for a missing scope.
+static const uint32_t CACHE_NONE = 0xFFFFFFFF;
+
+//! A string held in the text of a cache.
+struct CacheText {
+    uint64_t offset;
+    uint64_t length;
+};
+
+struct CacheHeader {
+    char      magic[8];
+    uint32_t  version;
+    uint32_t  byte_order;
+    uint64_t  length;           //!< Size of the whole cache file.
+    uint64_t  source_size;
+    int64_t   source_mtime;
+    uint32_t  time_units;
+    uint32_t  time_resolution;
+    CacheText date;
+    CacheText version_text;
+    CacheText comment;
+    uint64_t  root_scope;
+    uint64_t  scope_count;
+    uint64_t  scopes;
+    uint64_t  signal_count;
+    uint64_t  signals;
+    uint64_t  history_count;
+    uint64_t  histories;
+    uint64_t  time_count;
+    uint64_t  times;
+};
+
+struct CacheScope {
+    CacheText name;
+    uint32_t  type;
+    uint32_t  parent;           //!< Index of the parent, or CACHE_NONE.
+};
+
+struct CacheSignal {
+    CacheText hash;
+    CacheText reference;
+    uint32_t  scope;
+    uint32_t  size;
+    uint32_t  type;
+    int32_t   lindex;
+    int32_t   rindex;
+    uint32_t  id;
+};
+
+struct CacheHistory {
+    uint32_t  type;
+    uint32_t  width;
+    uint64_t  count;
+    uint64_t  times;
+    uint64_t  values;
+};
+
+static_assert(sizeof(CacheHeader)  % 8 == 0, "cache records must be 8 byte aligned");
+static_assert(sizeof(CacheScope)   % 8 == 0, "cache records must be 8 byte aligned");
+static_assert(sizeof(CacheSignal)  % 8 == 0, "cache records must be 8 byte aligned");
+static_assert(sizeof(CacheHistory) % 8 == 0, "cache records must be 8 byte aligned");
+
+
+//! Round @p offset up to a multiple of 8.
+static uint64_t align8(uint64_t offset) {
+    return (offset + 7) & ~(uint64_t)7;
+}
+
+
+//! Bytes of the value column of a history.
+static uint64_t value_bytes(const VCDSignalValues & values) {
+    switch(values.get_type()) {
+        case VCD_SCALAR: return values.get_scalars().size();
+        case VCD_VECTOR: return values.get_words().size() * sizeof(uint64_t);
+        case VCD_REAL:
+        default:         return values.get_reals().size() * sizeof(VCDReal);
+    }
+}
+
+
+//! Start of the value column of a history.
+static const void * value_data(const VCDSignalValues & values) {
+    switch(values.get_type()) {
+        case VCD_SCALAR: return values.get_scalars().data();
+        case VCD_VECTOR: return values.get_words().data();
+        case VCD_REAL:
+        default:         return values.get_reals().data();
+    }
+}
+
+
+/*!
+@brief Sequential writer of a cache file which keeps track of the offset.
+@details Errors are remembered rather than reported, and checked once at
+the end.
+*/
+class CacheWriter {
+
+    public:
+
+        CacheWriter(FILE * out) : out(out), offset(0), ok(true) {}
+
+        FILE     * out;
+        uint64_t   offset;
+        bool       ok;
+
+        void write(const void * data, size_t size) {
+            if(size > 0 && fwrite(data, 1, size, this -> out) != size) {
+                this -> ok = false;
+            }
+            this -> offset += size;
+        }
+
+        //! Pad with zeros up to @p to, the offset the layout expects next.
+        void pad(uint64_t to) {
+            static const char zeros[8] = {0};
+            if(to < this -> offset || to - this -> offset > sizeof(zeros)) {
+                this -> ok = false;
+                return;
+            }
+            this -> write(zeros, (size_t)(to - this -> offset));
+        }
+};
+
+
+/*!
+*/
+bool VCDFileCache::get_source(
+    const std::string & path,
+    Source            & source
+){
+    struct stat st;
+
+    if(path.empty() || path == "-" || ::stat(path.c_str(), &st) != 0 ||
+       (st.st_mode & S_IFMT) != S_IFREG) {
+        return false;
+    }
+
+#if defined(__APPLE__)
+    int64_t nanoseconds = st.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+    int64_t nanoseconds = 0;
+#else
+    int64_t nanoseconds = st.st_mtim.tv_nsec;
+#endif
+
+    source.size  = (uint64_t)st.st_size;
+    source.mtime = (int64_t)st.st_mtime * 1000000000 + nanoseconds;
+
+    return true;
+}
+
+
+/*!
+*/
+std::string VCDFileCache::get_path(
+    const std::string & source_path
+){
+    return source_path + ".cache";
+}
+
+
+/*!
+@details The layout is worked out in full before anything is written, so
+that records can hold the offsets of the columns which follow them.
+*/
+bool VCDFileCache::save(
+    const VCDFile     & file,
+    const Source      & source,
+    const std::string & cache_path
+){
+    // The histories of a lazily parsed file are not all loaded.
+    if(file.loader) {
+        return false;
+    }
+
+    CacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version         = CACHE_VERSION;
+    header.byte_order      = CACHE_BYTE_ORDER;
+    header.source_size     = source.size;
+    header.source_mtime    = source.mtime;
+    header.time_units      = (uint32_t)file.time_units;
+    header.time_resolution = (uint32_t)file.time_resolution;
+    header.root_scope      = CACHE_NONE;
+    header.scope_count     = file.scopes.size();
+    header.signal_count    = file.signals.size();
+    header.history_count   = file.val_map.size();
+    header.time_count      = file.get_timestamp_view().size();
+
+    header.scopes    = sizeof(CacheHeader);
+    header.signals   = header.scopes  + header.scope_count  * sizeof(CacheScope);
+    header.histories = header.signals + header.signal_count * sizeof(CacheSignal);
+
+    // Strings are gathered into one block after the records.
+    uint64_t    text_start = header.histories +
+                             header.history_count * sizeof(CacheHistory);
+    std::string text;
+
+    auto add_text = [&text, text_start](const std::string & s) {
+        CacheText t;
+        t.offset = text_start + text.size();
+        t.length = s.size();
+        text    += s;
+        return t;
+    };
+
+    header.date         = add_text(file.date);
+    header.version_text = add_text(file.version);
+    header.comment      = add_text(file.comment);
+
+    std::map<const VCDScope*, uint32_t> scope_index;
+    std::vector<CacheScope>             scopes(file.scopes.size());
+
+    for(size_t i = 0; i < file.scopes.size(); i ++) {
+        const VCDScope * scope = file.scopes[i];
+        scope_index[scope] = (uint32_t)i;
+
+        scopes[i].name   = add_text(scope -> name);
+        scopes[i].type   = (uint32_t)scope -> type;
+        scopes[i].parent = CACHE_NONE;
+
+        // The root scope has no parent set.
+        if(scope -> type != VCD_SCOPE_ROOT) {
+            auto parent = scope_index.find(scope -> parent);
+            if(parent != scope_index.end()) {
+                scopes[i].parent = parent -> second;
+            }
+        }
+
+        if(scope == file.root_scope) {
+            header.root_scope = i;
+        }
+    }
+
+    std::vector<CacheSignal> signals(file.signals.size());
+
+    for(size_t i = 0; i < file.signals.size(); i ++) {
+        const VCDSignal * signal = file.signals[i];
+        auto              scope  = scope_index.find(signal -> scope);
+
+        if(scope == scope_index.end()) {
+            return false;
+        }
+
+        signals[i].hash      = add_text(signal -> hash);
+        signals[i].reference = add_text(signal -> reference);
+        signals[i].scope     = scope -> second;
+        signals[i].size      = signal -> size;
+        signals[i].type      = (uint32_t)signal -> type;
+        signals[i].lindex    = signal -> lindex;
+        signals[i].rindex    = signal -> rindex;
+        signals[i].id        = signal -> id;
+    }
+
+    header.times = align8(text_start + text.size());
+
+    uint64_t                  offset = header.times +
+                                       header.time_count * sizeof(VCDTime);
+    std::vector<CacheHistory> histories(file.val_map.size());
+
+    for(size_t i = 0; i < file.val_map.size(); i ++) {
+        const VCDSignalValues * values = file.val_map[i];
+
+        histories[i].type   = (uint32_t)values -> get_type();
+        histories[i].width  = values -> get_width();
+        histories[i].count  = values -> size();
+        histories[i].times  = offset;
+        histories[i].values = offset + values -> size() * sizeof(VCDTime);
+
+        offset = align8(histories[i].values + value_bytes(*values));
+    }
+
+    header.length = offset;
+
+    // Written beside the cache and renamed over it once complete.
+    std::string temp_path = cache_path + ".tmp" + std::to_string(getpid());
+
+    FILE * out = fopen(temp_path.c_str(), "wb");
+    if(!out) {
+        return false;
+    }
+
+    CacheWriter writer(out);
+
+    writer.write(&header, sizeof(header));
+    writer.write(scopes.data(), scopes.size() * sizeof(CacheScope));
+    writer.write(signals.data(), signals.size() * sizeof(CacheSignal));
+    writer.write(histories.data(), histories.size() * sizeof(CacheHistory));
+    writer.write(text.data(), text.size());
+    writer.pad(header.times);
+    writer.write(file.get_timestamp_view().data(),
+                 header.time_count * sizeof(VCDTime));
+
+    for(size_t i = 0; i < file.val_map.size() && writer.ok; i ++) {
+        const VCDSignalValues * values = file.val_map[i];
+
+        writer.write(values -> get_times().data(),
+                     values -> size() * sizeof(VCDTime));
+        writer.write(value_data(*values), (size_t)value_bytes(*values));
+        writer.pad(align8(writer.offset));
+    }
+
+    bool ok = writer.ok && writer.offset == header.length;
+
+    if(fclose(out) != 0) {
+        ok = false;
+    }
+
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows.
+    if(ok) {
+        std::remove(cache_path.c_str());
+    }
+#endif
+
+    if(!ok || std::rename(temp_path.c_str(), cache_path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+
+/*!
+*/
+VCDFile * VCDFileCache::load(
+    const Source      & source,
+    const std::string & cache_path
+){
+    VCDFileCache * cache = new VCDFileCache();
+
+    VCDFile * file = nullptr;
+
+    if(cache -> open(cache_path)) {
+        file = cache -> build(source);
+    }
+
+    if(!file) {
+        delete cache;
+        return nullptr;
+    }
+
+    file -> cache = cache;
+
+    return file;
+}
+
+
+/*!
+*/
+VCDFileCache::VCDFileCache(){
+    this -> base   = nullptr;
+    this -> length = 0;
+    this -> mapped = false;
+}
+
+
+/*!
+*/
+VCDFileCache::~VCDFileCache(){
+#ifdef VCD_HAVE_MMAP
+    if(this -> mapped) {
+        munmap((void*)this -> base, this -> length);
+    }
+#endif
+}
+
+
+/*!
+@details Where files cannot be mapped the cache is read into memory
+instead, which still avoids parsing it.
+*/
+bool VCDFileCache::open(
+    const std::string & path
+){
+#ifdef VCD_HAVE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    void      * base = MAP_FAILED;
+
+    if(fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(CacheHeader)) {
+        base = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+
+    ::close(fd);
+
+    if(base == MAP_FAILED) {
+        return false;
+    }
+
+    this -> base   = (const char*)base;
+    this -> length = (size_t)st.st_size;
+    this -> mapped = true;
+
+    return true;
+#else
+    struct stat st;
+
+    if(::stat(path.c_str(), &st) != 0 || st.st_size < (long)sizeof(CacheHeader)) {
+        return false;
+    }
+
+    FILE * in = fopen(path.c_str(), "rb");
+    if(!in) {
+        return false;
+    }
+
+    this -> copy.resize(((size_t)st.st_size + 7) / 8);
+    this -> length = fread(this -> copy.data(), 1, (size_t)st.st_size, in);
+    this -> base   = (const char*)this -> copy.data();
+
+    fclose(in);
+
+    return this -> length == (size_t)st.st_size;
+#endif
+}
+
+
+/*!
+@brief Locate an array of @p count T at @p offset of a cache.
+@returns nullptr if it is misaligned or does not fit in the cache.
+*/
+template<typename T>
+static const T * cache_array(
+    const char * base,
+    size_t       length,
+    uint64_t     offset,
+    uint64_t     count
+){
+    if(offset % alignof(T) != 0 || offset > length ||
+       count > (length - offset) / sizeof(T)) {
+        return nullptr;
+    }
+    return (const T*)(base + offset);
+}
+
+
+/*!
+@details Every offset, count and index read from the cache is checked,
+so a truncated or damaged cache is rejected rather than read out of
+bounds.
+*/
+VCDFile * VCDFileCache::build(
+    const Source & source
+){
+    const char * base   = this -> base;
+    size_t       length = this -> length;
+
+    const CacheHeader * header = cache_array<CacheHeader>(base, length, 0, 1);
+
+    if(!header ||
+       std::memcmp(header -> magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+       header -> version      != CACHE_VERSION ||
+       header -> byte_order   != CACHE_BYTE_ORDER ||
+       header -> length       != length ||
+       header -> source_size  != source.size ||
+       header -> source_mtime != source.mtime ||
+       header -> time_units   >  (uint32_t)TIME_FS) {
+        return nullptr;
+    }
+
+    const CacheScope   * scopes    = cache_array<CacheScope>(
+        base, length, header -> scopes, header -> scope_count);
+    const CacheSignal  * signals   = cache_array<CacheSignal>(
+        base, length, header -> signals, header -> signal_count);
+    const CacheHistory * histories = cache_array<CacheHistory>(
+        base, length, header -> histories, header -> history_count);
+    const VCDTime      * times     = cache_array<VCDTime>(
+        base, length, header -> times, header -> time_count);
+
+    if(!scopes || !signals || !histories || !times) {
+        return nullptr;
+    }
+
+    auto get_text = [base, length](const CacheText & t, std::string & s) {
+        const char * chars = cache_array<char>(base, length, t.offset, t.length);
+        if(chars) {
+            s.assign(chars, (size_t)t.length);
+        }
+        return chars != nullptr;
+    };
+
+    VCDFile * file = new VCDFile();
+    bool      ok   = true;
+
+    file -> root_scope      = nullptr;
+    file -> time_units      = (VCDTimeUnit)header -> time_units;
+    file -> time_resolution = (VCDTimeRes)header -> time_resolution;
+
+    ok = get_text(header -> date,         file -> date)    &&
+         get_text(header -> version_text, file -> version) &&
+         get_text(header -> comment,      file -> comment);
+
+    // Parents come before their children, as the scopes were declared.
+    for(uint64_t i = 0; ok && i < header -> scope_count; i ++) {
+        const CacheScope & record = scopes[i];
+
+        VCDScope * scope = new VCDScope();
+        file -> add_scope(scope);
+
+        ok = get_text(record.name, scope -> name) &&
+             record.type <= (uint32_t)VCD_SCOPE_ROOT &&
+             (record.parent == CACHE_NONE || record.parent < i);
+
+        if(ok) {
+            scope -> type   = (VCDScopeType)record.type;
+            scope -> parent = nullptr;
+            if(record.parent != CACHE_NONE) {
+                scope -> parent = file -> scopes[record.parent];
+                scope -> parent -> children.push_back(scope);
+            }
+        }
+    }
+
+    if(ok && header -> root_scope != CACHE_NONE) {
+        ok = header -> root_scope < header -> scope_count;
+        if(ok) {
+            file -> root_scope = file -> scopes[header -> root_scope];
+        }
+    }
+
+    // Adding the signals in order assigns them the ids they had.
+    for(uint64_t i = 0; ok && i < header -> signal_count; i ++) {
+        const CacheSignal & record = signals[i];
+
+        ok = record.scope < header -> scope_count &&
+             record.type <= (uint32_t)VCD_VAR_WOR;
+        if(!ok) {
+            break;
+        }
+
+        VCDSignal * signal = new VCDSignal();
+        VCDScope  * scope  = file -> scopes[record.scope];
+
+        scope -> signals.push_back(signal);
+
+        signal -> scope  = scope;
+        signal -> size   = record.size;
+        signal -> type   = (VCDVarType)record.type;
+        signal -> lindex = record.lindex;
+        signal -> rindex = record.rindex;
+
+        ok = get_text(record.hash, signal -> hash) &&
+             get_text(record.reference, signal -> reference);
+
+        if(ok) {
+            file -> add_signal(signal);
+            ok = signal -> id == record.id;
+        }
+    }
+
+    ok = ok && header -> history_count == file -> get_signal_id_count();
+
+    for(uint64_t i = 0; ok && i < header -> history_count; i ++) {
+        const CacheHistory & record = histories[i];
+        VCDSignalValues    * values = file -> get_signal_values((VCDSignalId)i);
+
+        ok = record.type  == (uint32_t)values -> get_type() &&
+             record.width == values -> get_width();
+        if(!ok) {
+            break;
+        }
+
+        const VCDTime * history_times = cache_array<VCDTime>(
+            base, length, record.times, record.count);
+
+        VCDSpan<uint8_t>  scalars;
+        VCDSpan<uint64_t> words;
+        VCDSpan<VCDReal>  reals;
+
+        const void * column = nullptr;
+
+        switch(values -> get_type()) {
+            case VCD_SCALAR:
+                column  = cache_array<uint8_t>(base, length, record.values, record.count);
+                scalars = VCDSpan<uint8_t>((const uint8_t*)column, record.count);
+                break;
+            case VCD_VECTOR:
+                if(record.count <= length / sizeof(uint64_t) / values -> get_stride()) {
+                    uint64_t count = record.count * values -> get_stride();
+                    column = cache_array<uint64_t>(base, length, record.values, count);
+                    words  = VCDSpan<uint64_t>((const uint64_t*)column, count);
+                }
+                break;
+            case VCD_REAL:
+            default:
+                column = cache_array<VCDReal>(base, length, record.values, record.count);
+                reals  = VCDSpan<VCDReal>((const VCDReal*)column, record.count);
+                break;
+        }
+
+        ok = history_times != nullptr && column != nullptr;
+
+        if(ok) {
+            values -> refer(VCDSpan<VCDTime>(history_times, record.count),
+                            scalars, words, reals);
+        }
+    }
+
+    if(!ok) {
+        delete file;
+        return nullptr;
+    }
+
+    // Refers to the mapping, like the histories.
+    file -> cached_times   = VCDSpan<VCDTime>(times, header -> time_count);
+    file -> times_borrowed = true;
+
+    return file;
+}
@@ -0,0 +1,130 @@
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "VCDTypes.hpp"
+
+/*!
+@file VCDFileCache.hpp
+@brief Binary copies of parsed VCD files which load without parsing.
+*/
+
+#ifndef VCDFileCache_HPP
+#define VCDFileCache_HPP
+
+class VCDFile;
+
+/*!
+@brief A parsed VCDFile saved to a sidecar file next to its source.
+@details save() writes the header strings, the scope tree, the signals,
+the timestamps and every history in the columnar form VCDSignalValues
+keeps in memory. load() memory maps such a file and builds a VCDFile
+whose timestamps and histories refer to the mapped columns, so loading
+costs a few allocations per scope and signal and none per timestamp or
+value change. The mapping is owned by the loaded file and released with
+it.
+
+A cache records the size and modification time of the file it was made
+from, and load() rejects it once they no longer match. It is only
+meaningful on the machine which wrote it: it holds values in the byte
+order and layout of that machine, and is rejected elsewhere.
+
+Caches are written to a temporary file which is then renamed over the
+old one, so a cache which is mapped by another process is never changed
+underneath it.
+
+Used by VCDFileParser::parse_file() when VCDFileParser::use_cache is set.
+*/
+class VCDFileCache {
+
+    public:
+
+        //! Identifies the version of a source file a cache was made from.
+        struct Source {
+            uint64_t size;      //!< Size in bytes.
+            int64_t  mtime;     //!< Modification time, in ns since the epoch.
+        };
+
+        /*!
+        @brief Read the size and modification time of a source file.
+        @returns false if the file does not exist or is not a regular file.
+        */
+        static bool get_source(
+            const std::string & path,
+            Source            & source
+        );
+
+        //! Path of the cache of @p source_path, next to it.
+        static std::string get_path(
+            const std::string & source_path
+        );
+
+        /*!
+        @brief Write a parsed file to a cache.
+        @param file in - The parsed file.
+        @param source in - The source file as it was before it was parsed.
+        @param cache_path in - The cache file to write or replace.
+        @returns false if the cache could not be written, or @p file is
+        from VCDFileParser::parse_lazy().
+        */
+        static bool save(
+            const VCDFile     & file,
+            const Source      & source,
+            const std::string & cache_path
+        );
+
+        /*!
+        @brief Load a file from its cache.
+        @param source in - The source file as it is now.
+        @param cache_path in - The cache file to read.
+        @returns The file, or nullptr if there is no cache, or it is out
+        of date or malformed.
+        */
+        static VCDFile * load(
+            const Source      & source,
+            const std::string & cache_path
+        );
+
+        //! Unmap the cache.
+        ~VCDFileCache();
+
+    protected:
+
+        //! Open cache files are only made by load().
+        VCDFileCache();
+
+        //! First byte of the cache file.
+        const char * base;
+
+        //! Size of the cache file.
+        size_t       length;
+
+        //! Whether base is a mapping rather than pointing into copy.
+        bool         mapped;
+
+        //! Contents of the file where it cannot be mapped.
+        std::vector<uint64_t> copy;
+
+        /*!
+        @brief Map or read the cache file.
+        @returns false if it cannot be opened or read.
+        */
+        bool open(
+            const std::string & path
+        );
+
+        //! Build a VCDFile from the opened cache, or nullptr if it is malformed.
+        VCDFile * build(
+            const Source & source
+        );
+
+    private:
+
+        // Caches own their mapping and cannot be copied.
+        VCDFileCache(const VCDFileCache &);
+        VCDFileCache & operator= (const VCDFileCache &);
+};
+
+#endif
@@ -0,0 +1,346 @@
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "VCDFileIndex.hpp"
+#include "VCDFileParser.hpp"
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+
+/*
+The layout of an index file.
+
+    IndexHeader
+    char       states[]                  the state of each checkpoint
+    Checkpoint checkpoints[count]        at offset table
+*/
+
+static const char     INDEX_MAGIC[8]   = {'V','C','D','I','N','D','E','X'};
+static const uint32_t INDEX_VERSION    = 1;
+static const uint32_t INDEX_BYTE_ORDER = 0x01020304;
+
+struct IndexHeader {
+    char      magic[8];
+    uint32_t  version;
+    uint32_t  byte_order;
+    uint64_t  source_size;
+    int64_t   source_mtime;
+    uint64_t  interval;
+    uint64_t  count;
+    uint64_t  table;            //!< Offset of the checkpoints.
+};
+
+
+//! Move to @p offset of @p file, which may be past 2GB.
+static bool seek_to(FILE * file, uint64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(file, (__int64)offset, SEEK_SET) == 0;
+#else
+    return fseeko(file, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+
+/*!
+*/
+VCDFileIndex::VCDFileIndex(){
+}
+
+
+/*!
+*/
+std::string VCDFileIndex::get_path(
+    const std::string & source_path
+){
+    return source_path + ".index";
+}
+
+
+/*!
+@details The header is parsed as for VCDFileParser::parse_file(), then
+the body is scanned keeping the text of the last value change of every
+signal. Checkpoint states are written out as they are reached and the
+table of checkpoints once the scan is done, so memory use does not grow
+with the number of checkpoints.
+
+Times are expected to increase through the file. If they ever go back,
+no checkpoint can be trusted to hold everything before its time, and the
+index is written without any.
+*/
+bool VCDFileIndex::build(
+    const std::string & filepath,
+    const std::string & index_path,
+    size_t              interval
+){
+    VCDFileCache::Source source;
+
+    if(!VCDFileCache::get_source(filepath, source)) {
+        return false;
+    }
+
+    VCDFileParser parser;
+    parser.use_mmap = true;
+
+    bool ok = parser.begin_parse(filepath) && parser.input.is_mapped();
+
+    std::string temp_path = index_path + ".tmp" + std::to_string(getpid());
+    FILE      * out       = nullptr;
+
+    if(ok) {
+        out = fopen(temp_path.c_str(), "wb");
+        ok  = out != nullptr;
+    }
+
+    IndexHeader header;
+    std::memset(&header, 0, sizeof(header));
+
+    std::memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    header.version      = INDEX_VERSION;
+    header.byte_order   = INDEX_BYTE_ORDER;
+    header.source_size  = source.size;
+    header.source_mtime = source.mtime;
+    header.interval     = std::max<size_t>(1, interval);
+
+    // Written again with the final counts once the table is known.
+    ok = ok && fwrite(&header, sizeof(header), 1, out) == 1;
+
+    std::vector<Checkpoint> checkpoints;
+
+    if(ok && parser.end_of_header) {
+        const VCDFile * file = parser.fh;
+        size_t          ids  = file -> get_signal_id_count();
+
+        // Identifier code of each id, and the text of its last change.
+        std::vector<std::string> codes(ids);
+        std::vector<std::string> values(ids);
+
+        for(const VCDSignal * signal : *parser.fh -> get_signals()) {
+            if(codes[signal -> id].empty()) {
+                codes[signal -> id] = signal -> hash;
+            }
+        }
+
+        VCDBodyScanner body;
+        VCDBodyToken   token;
+        parser.begin_body(body);
+
+        const char * base      = parser.input.get_data();
+        const char * before    = body.get_position();
+        uint64_t     offset    = sizeof(header);
+        uint64_t     markers   = 0;
+        VCDTime      last      = 0;
+        bool         monotonic = true;
+        std::string  state;
+
+        while(ok && body.next(token)) {
+            VCDSignalId id = VCD_SIGNAL_ID_NONE;
+
+            switch(token.type) {
+                case VCD_BODY_TIME:
+                    monotonic = monotonic && (markers == 0 || token.time >= last);
+                    last      = token.time;
+
+                    if(monotonic && markers > 0 && markers % header.interval == 0) {
+                        state.clear();
+                        for(size_t i = 0; i < ids; i ++) {
+                            if(!values[i].empty()) {
+                                state += values[i];
+                                state += ' ';
+                                state += codes[i];
+                                state += '\n';
+                            }
+                        }
+
+                        Checkpoint checkpoint;
+                        checkpoint.time         = token.time;
+                        checkpoint.offset       = before - base;
+                        checkpoint.state        = offset;
+                        checkpoint.state_length = state.size();
+                        checkpoints.push_back(checkpoint);
+
+                        ok = state.empty() ||
+                             fwrite(state.data(), state.size(), 1, out) == 1;
+                        offset += state.size();
+                    }
+                    markers ++;
+                    break;
+
+                // The text of a change starts with its value type. Changes
+                // the history would drop leave the last value alone.
+                case VCD_BODY_SCALAR:
+                    id = file -> get_signal_id(token.code, token.code_length);
+                    if(id != VCD_SIGNAL_ID_NONE && parser.accepts(id, token)) {
+                        values[id].assign(token.text - 1, 1);
+                    }
+                    break;
+
+                case VCD_BODY_VECTOR:
+                case VCD_BODY_REAL:
+                    id = file -> get_signal_id(token.code, token.code_length);
+                    if(id != VCD_SIGNAL_ID_NONE && parser.accepts(id, token)) {
+                        values[id].assign(token.text - 1, token.length + 1);
+                    }
+                    break;
+
+                case VCD_BODY_ERROR:
+                    parser.error(body.syntax_error(token));
+                    ok = false;
+                    break;
+
+                default:
+                    break;
+            }
+
+            before = body.get_position();
+        }
+
+        if(!monotonic) {
+            checkpoints.clear();
+        }
+
+        header.count = checkpoints.size();
+        header.table = offset;
+    } else {
+        header.table = sizeof(header);
+    }
+
+    if(!parser.end_parse()) {
+        ok = false;
+    }
+    delete parser.fh;
+    parser.fh = nullptr;
+
+    if(out) {
+        ok = ok &&
+             (checkpoints.empty() ||
+              fwrite(checkpoints.data(), sizeof(Checkpoint),
+                     checkpoints.size(), out) == checkpoints.size()) &&
+             seek_to(out, 0) &&
+             fwrite(&header, sizeof(header), 1, out) == 1;
+
+        if(fclose(out) != 0) {
+            ok = false;
+        }
+    }
+
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows.
+    if(ok) {
+        std::remove(index_path.c_str());
+    }
+#endif
+
+    if(!ok || std::rename(temp_path.c_str(), index_path.c_str()) != 0) {
+        if(out) {
+            std::remove(temp_path.c_str());
+        }
+        return false;
+    }
+
+    return true;
+}
+
+
+/*!
+*/
+bool VCDFileIndex::load(
+    const std::string          & index_path,
+    const VCDFileCache::Source & source
+){
+    this -> path = index_path;
+    this -> checkpoints.clear();
+
+    FILE * in = fopen(index_path.c_str(), "rb");
+    if(!in) {
+        return false;
+    }
+
+    IndexHeader header;
+
+    bool ok = fread(&header, sizeof(header), 1, in) == 1 &&
+              std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0 &&
+              header.version      == INDEX_VERSION &&
+              header.byte_order   == INDEX_BYTE_ORDER &&
+              header.source_size  == source.size &&
+              header.source_mtime == source.mtime &&
+              header.table        >= sizeof(header) &&
+              seek_to(in, header.table);
+
+    // A damaged count must not be trusted to size the table up front.
+    Checkpoint checkpoint;
+
+    for(uint64_t i = 0; ok && i < header.count; i ++) {
+        ok = fread(&checkpoint, sizeof(checkpoint), 1, in) == 1 &&
+             checkpoint.state >= sizeof(header) &&
+             checkpoint.state <= header.table &&
+             checkpoint.state_length <= header.table - checkpoint.state &&
+             checkpoint.offset <= source.size &&
+             (this -> checkpoints.empty() ||
+              (checkpoint.time   >= this -> checkpoints.back().time &&
+               checkpoint.offset >= this -> checkpoints.back().offset));
+
+        if(ok) {
+            this -> checkpoints.push_back(checkpoint);
+        }
+    }
+
+    fclose(in);
+
+    if(!ok) {
+        this -> checkpoints.clear();
+    }
+
+    return ok;
+}
+
+
+/*!
+*/
+const VCDFileIndex::Checkpoint * VCDFileIndex::find(
+    VCDTime time
+) const {
+    auto it = std::upper_bound(
+        this -> checkpoints.begin(), this -> checkpoints.end(), time,
+        [](VCDTime t, const Checkpoint & c) { return t < c.time; });
+
+    if(it == this -> checkpoints.begin()) {
+        return nullptr;
+    }
+
+    return &*(it - 1);
+}
+
+
+/*!
+*/
+bool VCDFileIndex::read_state(
+    const Checkpoint & checkpoint,
+    std::string      & state
+) const {
+    state.clear();
+
+    if(checkpoint.state_length == 0) {
+        return true;
+    }
+
+    FILE * in = fopen(this -> path.c_str(), "rb");
+    if(!in) {
+        return false;
+    }
+
+    state.resize((size_t)checkpoint.state_length);
+
+    bool ok = seek_to(in, checkpoint.state) &&
+              fread(&state[0], state.size(), 1, in) == 1;
+
+    fclose(in);
+
+    return ok;
+}
@@ -0,0 +1,120 @@
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "VCDTypes.hpp"
+#include "VCDFileCache.hpp"
+
+/*!
+@file VCDFileIndex.hpp
+@brief Checkpoints for starting to parse a VCD file part way through.
+*/
+
+#ifndef VCDFileIndex_HPP
+#define VCDFileIndex_HPP
+
+/*!
+@brief Byte offsets of #time markers of a VCD file, with the state of
+every signal at each.
+@details build() scans a file once and writes an index next to it, with a
+checkpoint at every interval-th #time marker. A checkpoint holds the time
+and byte offset of the marker, and the value of every signal just before
+it. The values are kept as value change text, exactly as they appeared in
+the file, so restoring them is parsing a $dumpall block which lists them.
+
+With VCDFileParser::use_index set, a parse with a start_time looks for an
+index of its file. If there is one, the value changes before the last
+checkpoint at or before start_time are not scanned: the state of the
+checkpoint takes their place, and skipping to start_time continues from
+the marker.
+
+Like VCDFileCache, an index records the size and modification time of
+the file it was built from and is ignored once they change. Only memory
+mapped files are indexed, as the others cannot be read from an offset.
+*/
+class VCDFileIndex {
+
+    public:
+
+        //! Default number of #time markers between checkpoints.
+        static const size_t DEFAULT_INTERVAL = 4096;
+
+        //! A #time marker parsing can start from.
+        struct Checkpoint {
+            VCDTime  time;          //!< Time of the marker.
+            uint64_t offset;        //!< Offset in the file to start scanning at.
+            uint64_t state;         //!< Offset in the index of the state.
+            uint64_t state_length;  //!< Bytes of state.
+        };
+
+        //! Create an empty index.
+        VCDFileIndex();
+
+        //! Path of the index of @p source_path, next to it.
+        static std::string get_path(
+            const std::string & source_path
+        );
+
+        /*!
+        @brief Scan a VCD file and write its index.
+        @param filepath in - The VCD file, which must be memory mappable.
+        @param index_path in - The index file to write or replace.
+        @param interval in - Number of #time markers between checkpoints.
+        @returns false if the file could not be parsed or the index not
+        written.
+        */
+        static bool build(
+            const std::string & filepath,
+            const std::string & index_path,
+            size_t              interval = DEFAULT_INTERVAL
+        );
+
+        /*!
+        @brief Read the checkpoints of an index.
+        @param index_path in - The index file.
+        @param source in - The VCD file as it is now.
+        @returns false if there is no index, or it is out of date or
+        malformed.
+        */
+        bool load(
+            const std::string          & index_path,
+            const VCDFileCache::Source & source
+        );
+
+        //! The checkpoints, sorted by time and offset.
+        const std::vector<Checkpoint> & get_checkpoints() const {
+            return this -> checkpoints;
+        }
+
+        /*!
+        @brief Find the last checkpoint at or before a time.
+        @returns nullptr if every checkpoint is after @p time.
+        */
+        const Checkpoint * find(
+            VCDTime time
+        ) const;
+
+        /*!
+        @brief Read the state of a checkpoint from the index.
+        @param checkpoint in - One of get_checkpoints().
+        @param state out - Value changes setting every signal which had a
+        value to it, in the syntax of the value change section.
+        @returns false if the index could not be read.
+        */
+        bool read_state(
+            const Checkpoint & checkpoint,
+            std::string      & state
+        ) const;
+
+    protected:
+
+        //! The index file read by load().
+        std::string             path;
+
+        //! See get_checkpoints().
+        std::vector<Checkpoint> checkpoints;
+};
+
+#endif
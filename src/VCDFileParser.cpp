@@ -4,29 +4,56 @@
 */
 
 #include "VCDFileParser.hpp"
+#include "VCDFileCache.hpp"
+#include "VCDFileIndex.hpp"
+#include "VCDSignalLoader.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <cfloat>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#include <locale.h>
+#elif defined(__APPLE__)
+#include <xlocale.h>
+#endif
 
 // Forward declarations for flex reentrant functions
 extern "C" {
     int yylex_init(yyscan_t* scanner);
     int yylex_destroy(yyscan_t scanner);
-    void yyset_in(FILE* in_str, yyscan_t yyscanner);
     void yyset_extra(void* user_defined, yyscan_t yyscanner);
     void yyset_debug(int debug_flag, yyscan_t yyscanner);
 }
 
+// Defined in VCDScanner.l
+bool vcd_scan_in_place(char * base, size_t size, yyscan_t yyscanner);
+void vcd_scan_remaining(yyscan_t yyscanner, char ** data, size_t * size);
+
 VCDFileParser::VCDFileParser() {
 
-    this -> start_time = -std::numeric_limits<decltype(start_time)>::max();
+    this -> start_time = std::numeric_limits<decltype(start_time)>::min();
     this -> end_time = std::numeric_limits<decltype(end_time)>::max() ;
     this -> current_time = 0;
 
     this->trace_scanning = false;
     this->trace_parsing = false;
+    this->use_mmap = true;
+    this->use_cache = false;
+    this->use_index = false;
+    this->use_dumps = false;
+    this->read_block_size = VCDInput::DEFAULT_BLOCK_SIZE;
+    this->read_blocks = VCDInput::DEFAULT_BLOCKS;
+    this->handler = nullptr;
+    this->threads = 1;
+    this->lazy_capacity = 1024;
 
     this->scanner = nullptr;
-    this->input_file = nullptr;
 }
 
 VCDFileParser::~VCDFileParser()
@@ -35,16 +62,128 @@ VCDFileParser::~VCDFileParser()
 }
 
 VCDFile *VCDFileParser::parse_file(const std::string &filepath)
+{
+    VCDFileCache::Source source;
+
+    bool cached = use_cache &&
+                  selected_paths.empty() && selected_patterns.empty() &&
+                  start_time == std::numeric_limits<VCDTime>::min() &&
+                  end_time == std::numeric_limits<VCDTime>::max() &&
+                  VCDFileCache::get_source(filepath, source);
+
+    if(cached) {
+        VCDFile *tr = VCDFileCache::load(source, VCDFileCache::get_path(filepath));
+        if(tr) {
+            return tr;
+        }
+    }
+
+    VCDFile *tr = parse(filepath, false);
+
+    // The source was looked at before parsing, so if it changed while
+    // being parsed the cache is out of date as soon as it is written.
+    if(tr && cached) {
+        VCDFileCache::save(*tr, source, VCDFileCache::get_path(filepath));
+    }
+
+    return tr;
+}
+
+VCDFile *VCDFileParser::parse_header(const std::string &filepath)
+{
+    return parse(filepath, true);
+}
+
+bool VCDFileParser::parse_events(const std::string &filepath,
+                                 VCDEventHandler &handler)
+{
+    this->handler = &handler;
+    VCDFile *header = parse(filepath, false);
+    this->handler = nullptr;
+
+    // Scopes and signals passed to the handler live as long as the header.
+    delete header;
+    return header != nullptr;
+}
+
+VCDFile *VCDFileParser::parse_lazy(const std::string &filepath)
+{
+    bool ok = begin_parse(filepath);
+
+    if(ok && this->end_of_header) {
+        if(input.is_mapped()) {
+            char * data;
+            size_t size;
+            vcd_scan_remaining(scanner, &data, &size);
+
+            this->fh->loader = new VCDSignalLoader(*this, data, size,
+                                                   lazy_capacity);
+            ok = this->fh->loader->is_ready();
+        } else {
+            ok = parse_body();
+        }
+    }
+
+    if(!end_parse()) {
+        ok = false;
+    }
+
+    VCDFile *tr = this->fh;
+    this->fh = nullptr;
+
+    if (ok)
+    {
+        return tr;
+    }
+    else
+    {
+        delete tr;
+        return nullptr;
+    }
+}
+
+VCDFile *VCDFileParser::parse(const std::string &filepath, bool header_only)
+{
+    bool ok = begin_parse(filepath);
+
+    // The grammar stops after the header, the body has its own scanner.
+    if(ok && this->end_of_header && !header_only) {
+        ok = parse_body();
+    }
+
+    if(!end_parse()) {
+        ok = false;
+    }
+
+    VCDFile *tr = this->fh;
+    this->fh = nullptr;
+
+    if (ok)
+    {
+        return tr;
+    }
+    else
+    {
+        delete tr;
+        return nullptr;
+    }
+}
+
+bool VCDFileParser::begin_parse(const std::string &filepath)
 {
 
     this->filepath = filepath;
     this->current_time = 0;  // Reset current time for each parse
+    this->end_of_header = false;
 
     scan_begin();
 
     this->fh = new VCDFile();
     VCDFile *tr = this->fh;
 
+    this->sink.file = this->fh;
+    this->sink.handler = this->handler;
+
     this->fh->root_scope = new VCDScope;
     this->fh->root_scope->name = std::string("$root");
     this->fh->root_scope->type = VCD_SCOPE_ROOT;
@@ -54,6 +193,7 @@ VCDFile *VCDFileParser::parse_file(const std::string &filepath)
     this -> fh -> root_scope = new VCDScope;
     this -> fh -> root_scope -> name = std::string("");
     this -> fh -> root_scope -> type = VCD_SCOPE_ROOT;
+    this -> fh -> root_scope -> parent = nullptr;
 
     this -> scopes.push(this -> fh -> root_scope);
 
@@ -65,20 +205,149 @@ VCDFile *VCDFileParser::parse_file(const std::string &filepath)
 
     int result = parser.parse();
 
-    scopes.pop();
+    resolve_selection();
+
+    return result == 0;
+}
+
+void VCDFileParser::begin_body(VCDBodyScanner & body)
+{
+    char * data;
+    size_t size;
+
+    // Whatever flex has read beyond $enddefinitions $end comes first.
+    vcd_scan_remaining(scanner, &data, &size);
+
+    if(input.is_mapped()) {
+        body.reset(data, size);
+    } else {
+        body.reset(&input, data, size);
+    }
+    set_body_line(body);
+}
+
+void VCDFileParser::set_body_line(VCDBodyScanner & body) const
+{
+    // Lines of a mapped file are counted from its start, when needed.
+    if(input.is_mapped()) {
+        body.set_line(input.get_data(), 1);
+    } else {
+        body.set_line(body.get_position(), loc.end.line);
+    }
+}
+
+bool VCDFileParser::end_parse()
+{
+    bool ok = !input.failed();
+
+    if(!ok) {
+        error("Cannot read " + filepath + ": input error or bad compressed data");
+    }
+
+    while(!scopes.empty()) {
+        scopes.pop();
+    }
 
     scan_end();
 
-    if (result == 0)
-    {
-        this->fh = nullptr;
-        return tr;
+    return ok;
+}
+
+double VCDFileParser::get_progress() const
+{
+    uint64_t size = input.get_file_size();
+    if(size == 0) {
+        return -1;
     }
-    else
-    {
-        tr = nullptr;
-        delete this->fh;
-        return nullptr;
+    return std::min(1.0, (double)input.get_bytes_read() / (double)size);
+}
+
+void VCDFileParser::select(const std::string & path)
+{
+    selected_paths.insert(path);
+}
+
+void VCDFileParser::select_pattern(const std::string & pattern)
+{
+    selected_patterns.push_back(std::regex(pattern));
+}
+
+void VCDFileParser::clear_selection()
+{
+    selected_paths.clear();
+    selected_patterns.clear();
+    selection.clear();
+}
+
+/*!
+@brief Find the full path of a scope and whether it is selected.
+@details A scope is selected if its path is, or if its parent is. Both
+are memoised per scope, as every signal of a scope asks for them.
+*/
+static bool scope_selected(
+    VCDScope                                        * scope,
+    const std::set<std::string>                     & paths,
+    const std::vector<std::regex>                   & patterns,
+    std::map<VCDScope*, std::pair<std::string,bool>> & memo,
+    std::string                                     & path
+){
+    if(!scope || scope -> type == VCD_SCOPE_ROOT) {
+        path.clear();
+        return false;
+    }
+
+    auto it = memo.find(scope);
+    if(it != memo.end()) {
+        path = it -> second.first;
+        return it -> second.second;
+    }
+
+    bool selected = scope_selected(scope -> parent, paths, patterns, memo, path);
+    if(!path.empty()) {
+        path += ".";
+    }
+    path += scope -> name;
+
+    selected = selected || paths.count(path);
+    for(size_t i = 0; !selected && i < patterns.size(); i ++) {
+        selected = std::regex_match(path, patterns[i]);
+    }
+
+    memo[scope] = std::make_pair(path, selected);
+    return selected;
+}
+
+void VCDFileParser::resolve_selection()
+{
+    selection.clear();
+
+    if(selected_paths.empty() && selected_patterns.empty()) {
+        return;
+    }
+
+    selection.assign(fh->get_signal_id_count(), 0);
+
+    std::map<VCDScope*, std::pair<std::string,bool>> memo;
+    std::string path;
+
+    for(VCDSignal * signal : *fh->get_signals()) {
+        bool selected = scope_selected(signal->scope, selected_paths,
+                                       selected_patterns, memo, path);
+        if(!selected) {
+            if(!path.empty()) {
+                path += ".";
+            }
+            path += signal->reference;
+
+            selected = selected_paths.count(path);
+            for(size_t i = 0; !selected && i < selected_patterns.size(); i ++) {
+                selected = std::regex_match(path, selected_patterns[i]);
+            }
+        }
+
+        if(selected) {
+            selection[signal->id] = 1;
+        }
     }
 }
 
@@ -93,6 +362,652 @@ void VCDFileParser::error(const std::string & m){
     std::cerr << " : "<<m<<std::endl;
 }
 
+void VCDEventSink::add_signal_value(
+    VCDSignalId  id,
+    VCDTime      time,
+    const char * digits,
+    size_t       length
+){
+    if(!this->handler) {
+        this->file->add_signal_value(id, time, digits, length);
+        return;
+    }
+
+    VCDSignalSize width = this->file->get_signal_values(id)->get_width();
+    size_t        words = std::max<size_t>(2, 2 * VCDValue::words_for_width(width));
+
+    if(this->planes.size() < words) {
+        this->planes.resize(words);
+    }
+
+    VCDValue::decode_binary(digits, length, width, this->planes.data());
+    this->handler->on_vector(time, id, VCDValue(width, this->planes.data()));
+}
+
+//! Parse a NUL terminated real with the "C" locale, whatever the global one.
+static double strtod_c(const char * text)
+{
+#ifdef _WIN32
+    static _locale_t c_locale = _create_locale(LC_NUMERIC, "C");
+    return _strtod_l(text, nullptr, c_locale);
+#else
+    static locale_t c_locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+    return strtod_l(text, nullptr, c_locale);
+#endif
+}
+
+/*!
+@details Decimal numbers of up to 19 significant digits are first read
+into an integer mantissa and a power of ten. When both the mantissa and
+the power are exactly representable as doubles, a single multiplication
+or division gives the correctly rounded result (Clinger's fast path).
+This covers the values printed by simulators with "%.16g". Anything else,
+including "inf" and "nan", goes to strtod() with the "C" locale, so the
+result is always exact and never depends on the locale.
+*/
+VCDReal VCDFileParser::parse_real(const char * text, size_t length) {
+    static const double powers[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+        1e22
+    };
+
+    const char * p   = text;
+    const char * end = text + length;
+
+    bool     negative  = false;
+    uint64_t mantissa  = 0;
+    int      digits    = 0;
+    int      exponent  = 0;
+    bool     any;
+    bool     truncated = false;
+
+    if(p < end && (*p == '-' || *p == '+')) {
+        negative = *p++ == '-';
+    }
+
+    const char * digits_start = p;
+    for(; p < end && (unsigned)((unsigned char)*p - '0') <= 9; p ++) {
+        unsigned d = *p - '0';
+        if(digits < 19) {
+            mantissa = mantissa * 10 + d;
+            digits  += mantissa != 0;
+        } else {
+            truncated |= d != 0;
+            exponent  ++;
+        }
+    }
+    any = p != digits_start;
+
+    if(p < end && *p == '.') {
+        const char * fraction_start = ++ p;
+        for(; p < end && (unsigned)((unsigned char)*p - '0') <= 9; p ++) {
+            unsigned d = *p - '0';
+            if(digits < 19) {
+                mantissa = mantissa * 10 + d;
+                digits  += mantissa != 0;
+                exponent --;
+            } else {
+                truncated |= d != 0;
+            }
+        }
+        any |= p != fraction_start;
+    }
+
+    if(any && p < end && (*p == 'e' || *p == 'E')) {
+        const char * q     = p + 1;
+        bool         minus = false;
+        int          power = 0;
+
+        if(q < end && (*q == '-' || *q == '+')) {
+            minus = *q++ == '-';
+        }
+        if(q < end && (unsigned)((unsigned char)*q - '0') <= 9) {
+            for(; q < end && (unsigned)((unsigned char)*q - '0') <= 9; q ++) {
+                if(power < 100000) {
+                    power = power * 10 + (*q - '0');
+                }
+            }
+            exponent += minus ? -power : power;
+            p = q;
+        }
+    }
+
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+    if(any && p == end && !truncated) {
+        double value = 0;
+
+        if(mantissa == 0) {
+            return negative ? -0.0 : 0.0;
+        }
+
+        if(mantissa <= (uint64_t(1) << 53)) {
+            if(exponent >= -22 && exponent <= 22) {
+                value = (double)mantissa;
+                value = exponent < 0 ? value / powers[-exponent]
+                                     : value * powers[exponent];
+                return negative ? -value : value;
+            }
+
+            // Moving zeros from the power onto the mantissa may keep it exact.
+            if(exponent > 22 && exponent <= 22 + 15) {
+                uint64_t scaled = mantissa;
+                int      shift  = exponent - 22;
+                while(shift > 0 && scaled <= (uint64_t(1) << 53) / 10) {
+                    scaled *= 10;
+                    shift  --;
+                }
+                if(shift == 0) {
+                    value = (double)scaled * powers[22];
+                    return negative ? -value : value;
+                }
+            }
+        }
+    }
+#endif
+
+    char buffer[64];
+    if(length < sizeof(buffer)) {
+        std::memcpy(buffer, text, length);
+        buffer[length] = '\0';
+        return strtod_c(buffer);
+    }
+    return strtod_c(std::string(text, length).c_str());
+}
+
+/*!
+@brief The value changes of one slice of the body, parsed by one thread.
+@details Provides the add_timestamp() and add_signal_value() methods of
+VCDFile, so the value change rules of VCDFileParser can record into it.
+Histories are created on the first change of each signal, with the type
+and width of the matching history of the file.
+*/
+class VCDBodyChunk {
+
+    public:
+
+        VCDBodyChunk(const VCDFile * file, size_t index,
+                     std::atomic<size_t> * last) {
+            this -> file    = file;
+            this -> index   = index;
+            this -> last    = last;
+            this -> now     = 0;
+            this -> ok      = true;
+            this -> stopped = false;
+            this -> values.resize(file -> get_signal_id_count(), nullptr);
+        }
+
+        ~VCDBodyChunk() {
+            for(VCDSignalValues * v : this -> values) {
+                delete v;
+            }
+        }
+
+        //! Whether a chunk before this one has already reached end_time.
+        bool cancelled() const {
+            return this -> index > this -> last -> load(std::memory_order_relaxed);
+        }
+
+        void add_timestamp(VCDTime time) {
+            this -> times.push_back(time);
+        }
+
+        void add_signal_value(VCDSignalId id, VCDTime time, VCDBit value) {
+            this -> history(id) -> append_scalar(time, value);
+        }
+
+        void add_signal_value(VCDSignalId id, VCDTime time,
+                              const char * digits, size_t length) {
+            this -> history(id) -> append_vector(time, digits, length);
+        }
+
+        void add_signal_value(VCDSignalId id, VCDTime time, VCDReal value) {
+            this -> history(id) -> append_real(time, value);
+        }
+
+        //! The file whose body this is part of.
+        const VCDFile * file;
+
+        //! Position of the chunk in the body.
+        size_t index;
+
+        //! Index of the last chunk which needs parsing.
+        std::atomic<size_t> * last;
+
+        //! First and last + 1 characters of the slice.
+        const char * begin;
+        const char * end;
+
+        //! Current time while parsing, and after it the last time seen.
+        VCDTime now;
+
+        //! Recorded timestamps.
+        std::vector<VCDTime> times;
+
+        //! Histories indexed by signal id, nullptr for signals with no changes.
+        std::vector<VCDSignalValues*> values;
+
+        //! False if the slice held a syntax error, described by message.
+        bool ok;
+        std::string message;
+
+        //! Whether parsing stopped at end_time.
+        bool stopped;
+
+    protected:
+
+        VCDSignalValues * history(VCDSignalId id) {
+            if(!this -> values[id]) {
+                const VCDSignalValues * h = this -> file -> get_signal_values(id);
+                this -> values[id] = new VCDSignalValues(h -> get_type(),
+                                                         h -> get_width());
+            }
+            return this -> values[id];
+        }
+
+    private:
+
+        VCDBodyChunk(const VCDBodyChunk &);
+        VCDBodyChunk & operator= (const VCDBodyChunk &);
+};
+
+//! Whether a scan into @p sink should stop early.
+static bool cancelled(const VCDEventSink &) {
+    return false;
+}
+
+//! Whether a scan into @p chunk should stop early.
+static bool cancelled(const VCDBodyChunk & chunk) {
+    return chunk.cancelled();
+}
+
+/*!
+@brief Apply every token of a body scanner to @p target.
+@param stopped out - Set if parsing stopped at a time past end_time.
+@param message out - Describes a syntax error.
+@returns false on a syntax error.
+*/
+template<typename Target>
+static bool scan_body(
+    const VCDFileParser & driver,
+    VCDBodyScanner      & body,
+    Target              & target,
+    VCDTime             & now,
+    bool                & stopped,
+    std::string         & message
+){
+    VCDBodyToken token;
+
+    stopped = false;
+
+    while(body.next(token)) {
+        if(token.type == VCD_BODY_ERROR) {
+            message = body.syntax_error(token);
+            return false;
+        }
+        if(!driver.apply_token(target, now, token) ||
+           (token.type == VCD_BODY_TIME && cancelled(target))) {
+            stopped = true;
+            return true;
+        }
+    }
+
+    return true;
+}
+
+bool VCDFileParser::parse_body() {
+    char * data;
+    size_t size;
+
+    // Whatever flex has read beyond $enddefinitions $end comes first.
+    vcd_scan_remaining(scanner, &data, &size);
+
+    // The state of a checkpoint, skipped ahead of the value changes.
+    std::string checkpoint;
+
+    if(input.is_mapped()) {
+        seek_index(data, size, checkpoint);
+        seek_dumps(data, size);
+    }
+
+    VCDBodyScanner body;
+    if(input.is_mapped()) {
+        body.reset(data, size);
+    } else {
+        body.reset(&input, data, size);
+    }
+    set_body_line(body);
+
+    bool        stopped;
+    std::string message;
+
+    if(start_time != std::numeric_limits<VCDTime>::min()) {
+        VCDBodyToken none;
+        none.type = VCD_BODY_COMMAND;
+
+        std::vector<VCDBodyToken> state(fh->get_signal_id_count(), none);
+        std::vector<std::string>  copies;
+        VCDBodyToken              marker;
+
+        if(!checkpoint.empty()) {
+            VCDBodyScanner saved;
+            saved.reset(checkpoint.data(), checkpoint.size());
+
+            if(!skip_body(saved, current_time, state, nullptr, marker, message)) {
+                error("Bad index " + VCDFileIndex::get_path(filepath) + ": " + message);
+                return false;
+            }
+        }
+
+        if(!input.is_mapped()) {
+            copies.resize(state.size());
+        }
+
+        if(!skip_body(body, current_time, state,
+                      input.is_mapped() ? nullptr : &copies, marker, message)) {
+            error(message);
+            return false;
+        }
+
+        // Nothing is left at or after start_time, or before end_time.
+        if(marker.type != VCD_BODY_TIME ||
+           !apply_skipped(sink, current_time, state, marker)) {
+            return true;
+        }
+
+        if(input.is_mapped()) {
+            size_t skipped = body.get_position() - data;
+            size -= skipped;
+            data += skipped;
+        }
+    }
+
+    // Events go to a handler in file order, so only files are built in parallel.
+    if(input.is_mapped() && !handler) {
+        size_t chunks = std::min<size_t>(threads, size / MIN_PARALLEL_CHUNK);
+        if(chunks > 1) {
+            return parse_body_parallel(data, size, chunks);
+        }
+    }
+
+    if(!scan_body(*this, body, sink, current_time, stopped, message)) {
+        error(message);
+        return false;
+    }
+
+    return true;
+}
+
+void VCDFileParser::seek_index(char * & data, size_t & size,
+                               std::string & state) {
+    VCDFileCache::Source source;
+    VCDFileIndex         index;
+
+    if(!use_index || start_time == std::numeric_limits<VCDTime>::min() ||
+       !VCDFileCache::get_source(filepath, source) ||
+       !index.load(VCDFileIndex::get_path(filepath), source)) {
+        return;
+    }
+
+    const VCDFileIndex::Checkpoint * checkpoint = index.find(start_time);
+    if(!checkpoint) {
+        return;
+    }
+
+    // Only ever skip forward from where the grammar stopped.
+    char * at = input.get_data() + checkpoint -> offset;
+
+    if(at < data || at > data + size || !index.read_state(*checkpoint, state)) {
+        state.clear();
+        return;
+    }
+
+    current_time = checkpoint -> time;
+
+    size -= at - data;
+    data  = at;
+}
+
+bool VCDFileParser::skip_body(
+    VCDBodyScanner            & body,
+    VCDTime                   & now,
+    std::vector<VCDBodyToken> & state,
+    std::vector<std::string>  * copies,
+    VCDBodyToken              & marker,
+    std::string               & message
+) const {
+    while(body.next(marker)) {
+        VCDSignalId id;
+
+        switch(marker.type) {
+            case VCD_BODY_TIME:
+                if(marker.time >= start_time || marker.time > end_time) {
+                    return true;
+                }
+                now = marker.time;
+                break;
+
+            case VCD_BODY_SCALAR:
+            case VCD_BODY_VECTOR:
+            case VCD_BODY_REAL:
+                // A change the history would drop must not hide the one before.
+                id = fh->get_signal_id(marker.code, marker.code_length);
+                if(is_selected(id) && accepts(id, marker)) {
+                    state[id] = marker;
+                    if(copies && marker.type != VCD_BODY_SCALAR) {
+                        (*copies)[id].assign(marker.text, marker.length);
+                        state[id].text = (*copies)[id].data();
+                    }
+                }
+                break;
+
+            case VCD_BODY_ERROR:
+                message = body.syntax_error(marker);
+                return false;
+
+            default:
+                break;
+        }
+    }
+
+    marker.type = VCD_BODY_COMMAND;
+    return true;
+}
+
+/*!
+@brief Find the #time marker a position in the value changes belongs to.
+@details As when cutting the body into chunks, only a '#' which starts a
+line is taken for a marker, as one elsewhere could be an identifier code.
+@param begin in - Start of the value changes.
+@param at in - The position.
+@param marker out - The '#' of the marker.
+@param time out - The time of the marker.
+@returns false if there is no marker before @p at.
+*/
+static bool marker_before(
+    const char *   begin,
+    const char *   at,
+    const char * & marker,
+    VCDTime      & time
+){
+    for(const char * p = at; p > begin; ) {
+        p --;
+        if(*p != '#' || (p > begin && p[-1] != '\n')) {
+            continue;
+        }
+
+        const char * q = p + 1;
+        while(q < at && *q >= '0' && *q <= '9') {
+            q ++;
+        }
+        if(q > p + 1 && (q == at || (unsigned char)*q <= ' ')) {
+            marker = p;
+            time   = VCDFileParser::parse_time(p + 1, q - p - 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+@details Dump blocks are found with memchr on '$', as keywords are rare
+among value changes, so the prescan runs at memory speed. It stops at the
+first block past start_time.
+*/
+void VCDFileParser::seek_dumps(char * & data, size_t & size) {
+    if(!use_dumps || start_time == std::numeric_limits<VCDTime>::min()) {
+        return;
+    }
+
+    const char * end    = data + size;
+    const char * anchor = nullptr;
+    const char * p      = data;
+
+    while((p = (const char *)std::memchr(p, '$', end - p))) {
+        const char * word = p ++;
+
+        bool dump = (end - word >= 8 && std::memcmp(word, "$dumpall", 8) == 0) ||
+                    (end - word >= 9 && std::memcmp(word, "$dumpvars", 9) == 0);
+        if(!dump || (word > data && (unsigned char)word[-1] > ' ')) {
+            continue;
+        }
+
+        const char * marker;
+        VCDTime      time;
+
+        if(!marker_before(data, word, marker, time)) {
+            continue;
+        }
+        if(time > start_time) {
+            break;
+        }
+        anchor = marker;
+    }
+
+    if(anchor) {
+        size -= anchor - data;
+        data  = (char *)anchor;
+    }
+}
+
+/*!
+@details The body is cut at the start of a line beginning with '#'. As
+value changes only depend on the time before them, each chunk is parsed
+independently into its own histories, which are then appended to those
+of fh in order. The appending is also spread over the threads, each
+taking a share of the signals.
+*/
+bool VCDFileParser::parse_body_parallel(
+    const char * data,
+    size_t       size,
+    size_t       count
+){
+    const char * end = data + size;
+
+    std::atomic<size_t>         last(count - 1);
+    std::vector<VCDBodyChunk *> chunks;
+
+    for(size_t i = 0; i < count; i ++) {
+        VCDBodyChunk * chunk = new VCDBodyChunk(fh, i, &last);
+
+        chunk -> begin = i == 0 ? data : chunks.back() -> end;
+        chunk -> end   = end;
+
+        if(i + 1 < count) {
+            const char * p = std::max(data + size / count * (i + 1) - 1,
+                                      chunk -> begin);
+            while((p = (const char *)std::memchr(p, '\n', end - p))) {
+                p ++;
+                if(p == end || *p == '#') {
+                    break;
+                }
+            }
+            chunk -> end = p ? p : end;
+        }
+
+        chunks.push_back(chunk);
+    }
+
+    // Values before the first #time belong to the current time.
+    chunks[0] -> now = current_time;
+
+    std::vector<std::thread> workers;
+
+    for(VCDBodyChunk * chunk : chunks) {
+        workers.emplace_back([this, chunk, &last]() {
+            VCDBodyScanner body;
+            body.reset(chunk -> begin, chunk -> end - chunk -> begin);
+            set_body_line(body);
+
+            chunk -> ok = scan_body(*this, body, *chunk, chunk -> now,
+                                    chunk -> stopped, chunk -> message);
+
+            // Later chunks are past end_time, or follow a syntax error.
+            if(!chunk -> ok || (chunk -> stopped && !chunk -> cancelled())) {
+                size_t expected = last.load();
+                while(chunk -> index < expected &&
+                      !last.compare_exchange_weak(expected, chunk -> index)) {
+                }
+            }
+        });
+    }
+
+    for(std::thread & worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+
+    size_t used = last.load() + 1;
+    bool   ok   = true;
+
+    for(size_t i = 0; i < used; i ++) {
+        if(!chunks[i] -> ok) {
+            error(chunks[i] -> message);
+            ok = false;
+            break;
+        }
+    }
+
+    if(ok) {
+        for(size_t i = 0; i < used; i ++) {
+            for(VCDTime time : chunks[i] -> times) {
+                fh -> add_timestamp(time);
+            }
+        }
+        for(size_t i = used; i > 0; i --) {
+            if(chunks[i - 1] -> begin != chunks[i - 1] -> end || i == 1) {
+                current_time = chunks[i - 1] -> now;
+                break;
+            }
+        }
+
+        size_t ids = fh -> get_signal_id_count();
+
+        for(size_t w = 0; w < count; w ++) {
+            workers.emplace_back([this, w, count, used, ids, &chunks]() {
+                for(size_t id = w; id < ids; id += count) {
+                    VCDSignalValues * values = fh -> get_signal_values((VCDSignalId)id);
+                    for(size_t i = 0; i < used; i ++) {
+                        if(chunks[i] -> values[id]) {
+                            values -> append(*chunks[i] -> values[id]);
+                        }
+                    }
+                }
+            });
+        }
+
+        for(std::thread & worker : workers) {
+            worker.join();
+        }
+    }
+
+    for(VCDBodyChunk * chunk : chunks) {
+        delete chunk;
+    }
+
+    return ok;
+}
+
 VCDParser::parser::symbol_type VCDFileParser::get_next_token() {
     return yylex(scanner);
 }
@@ -107,33 +1022,27 @@ void VCDFileParser::scan_begin() {
     // Set debug flag
     yyset_debug(trace_scanning ? 1 : 0, scanner);
 
-    // Open the input file
-    if(filepath.empty() || filepath == "-") {
-        input_file = stdin;
-    } else {
-        input_file = fopen(filepath.c_str(), "r");
-        if(!input_file) {
-            error("Cannot open " + filepath + ": " + strerror(errno));
-            exit(EXIT_FAILURE);
-        }
+    // Open the input file, memory mapped where possible
+    if(!input.open(filepath, use_mmap, read_block_size, read_blocks)) {
+        error("Cannot open " + filepath + ": " + strerror(errno));
+        exit(EXIT_FAILURE);
     }
 
-    // Set the input file for the scanner
-    yyset_in(input_file, scanner);
+    // Scan a mapped file in place, otherwise read it through YY_INPUT
+    if(input.is_mapped()) {
+        vcd_scan_in_place(input.get_data(), input.get_size(), scanner);
+    }
 }
 
 void VCDFileParser::scan_end() {
-    // Close the input file if it's not stdin
-    if(input_file && input_file != stdin) {
-        fclose(input_file);
-    }
-    input_file = nullptr;
-
-    // Destroy the scanner
+    // Destroy the scanner before releasing the buffer it scans
     if(scanner) {
         yylex_destroy(scanner);
         scanner = nullptr;
     }
+
+    // Unmap or close the input file, stdin is left open
+    input.close();
 }
 
 #ifdef VCD_PARSER_STANDALONE
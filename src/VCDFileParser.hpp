@@ -8,13 +8,18 @@
 
 #include <string>
 #include <map>
+#include <regex>
 #include <set>
 #include <stack>
+#include <vector>
 #include <limits>
 
 #include "VCDParser.hpp"
 #include "VCDTypes.hpp"
 #include "VCDFile.hpp"
+#include "VCDInput.hpp"
+#include "VCDBodyScanner.hpp"
+#include "VCDEventHandler.hpp"
 
 // Forward declaration for reentrant scanner
 #ifndef YY_TYPEDEF_YY_SCANNER_T
@@ -28,6 +33,59 @@ typedef void* yyscan_t;
 YY_DECL;
 
 
+/*!
+@brief Where the value changes of a parse are recorded.
+@details Has the add_timestamp() and add_signal_value() methods of VCDFile
+used by the value change rules of VCDFileParser. Everything is passed to
+the handler when there is one, and stored in the file otherwise.
+*/
+class VCDEventSink {
+
+    public:
+
+        VCDEventSink() : file(nullptr), handler(nullptr) {}
+
+        //! The file being parsed, which holds the declarations.
+        VCDFile         * file;
+
+        //! Receives the value changes instead of file, if set.
+        VCDEventHandler * handler;
+
+        void add_timestamp(VCDTime time) {
+            if(this -> handler) {
+                this -> handler -> on_time(time);
+            } else {
+                this -> file -> add_timestamp(time);
+            }
+        }
+
+        void add_signal_value(VCDSignalId id, VCDTime time, VCDBit value) {
+            if(this -> handler) {
+                this -> handler -> on_scalar(time, id, value);
+            } else {
+                this -> file -> add_signal_value(id, time, value);
+            }
+        }
+
+        //! Decodes the digits to the declared width for the handler.
+        void add_signal_value(VCDSignalId id, VCDTime time,
+                              const char * digits, size_t length);
+
+        void add_signal_value(VCDSignalId id, VCDTime time, VCDReal value) {
+            if(this -> handler) {
+                this -> handler -> on_real(time, id, value);
+            } else {
+                this -> file -> add_signal_value(id, time, value);
+            }
+        }
+
+    protected:
+
+        //! Bit-planes of the last vector passed to the handler.
+        std::vector<uint64_t> planes;
+};
+
+
 /*!
 @brief Class for parsing files containing CSP notation.
 */
@@ -41,11 +99,83 @@ class VCDFileParser {
 
         /*!
         @brief Parse the suppled file.
+        @details With use_cache set, the file may instead be loaded from
+        its cache, see VCDFileCache.
         @returns A handle to the parsed VCDFile object or nullptr if parsing
         fails.
         */
         VCDFile * parse_file(const std::string & filepath);
 
+        /*!
+        @brief Parse only the header of the supplied file.
+        @details Stops reading right after $enddefinitions, so the
+        returned file has its scopes, signals and header strings but no
+        timestamps or value changes. A file without $enddefinitions is
+        parsed in full.
+        @returns A handle to the parsed VCDFile object or nullptr if parsing
+        fails.
+        */
+        VCDFile * parse_header(const std::string & filepath);
+
+        /*!
+        @brief Parse the supplied file, loading the history of each signal
+        when it is first asked for.
+        @details The header is parsed, then the value changes are scanned
+        once, without decoding them, to record the timestamps and where
+        each signal changes. The history of a signal is decoded by the
+        first VCDFile::get_signal_values() for it, see VCDSignalLoader,
+        and at most lazy_capacity histories are kept at once. start_time,
+        end_time and the signal selection apply as for parse_file(), but
+        neither use_cache nor use_index is used. Files which are not
+        memory mapped cannot be returned to, and are parsed in full.
+        @returns A handle to the parsed VCDFile object or nullptr if parsing
+        fails.
+        */
+        VCDFile * parse_lazy(const std::string & filepath);
+
+        /*!
+        @brief Stream the supplied file through an event handler.
+        @details Declarations and value changes are passed to @p handler
+        in file order and no value changes are stored, so memory use does
+        not grow with the length of the trace. start_time, end_time and
+        the signal selection apply as for parse_file(). The value changes
+        are always parsed on one thread.
+        @returns false if parsing fails.
+        */
+        bool parse_events(const std::string & filepath,
+                          VCDEventHandler   & handler);
+
+        /*!
+        @brief Keep the value changes of a signal, or of every signal in
+        a scope.
+        @details Once anything is selected, value changes of signals which
+        are not are skipped as they are scanned, costing neither decoding
+        nor memory, and their histories stay empty. A path is the names
+        of the enclosing scopes and of the signal joined by '.', such as
+        "top.cpu.pc". The selection is resolved against the declarations
+        once $enddefinitions has been parsed.
+        @param path in - Full path of a signal or scope.
+        */
+        void select(const std::string & path);
+
+        /*!
+        @brief Keep the value changes of every signal or scope whose full
+        path matches a regular expression.
+        @param pattern in - An ECMAScript regular expression, which must
+        match the whole path.
+        @throws std::regex_error if the pattern is malformed.
+        */
+        void select_pattern(const std::string & pattern);
+
+        //! Keep every value change again.
+        void clear_selection();
+
+        //! Whether the value changes of signal @p id are kept.
+        bool is_selected(VCDSignalId id) const {
+            return id != VCD_SIGNAL_ID_NONE &&
+                   (this -> selection.empty() || this -> selection[id]);
+        }
+
         //! The current file being parsed.
         std::string filepath;
 
@@ -55,12 +185,104 @@ class VCDFileParser {
         //! Should we debug parsing of tokens?
         bool trace_parsing;
 
-        //! Ignore anything before this timepoint
+        //! Memory map regular files rather than reading them through stdio.
+        bool use_mmap;
+
+        /*!
+        @brief Load parse_file() results from a cache next to the file.
+        @details A file whose cache is up to date is loaded from it
+        instead of being parsed. Otherwise it is parsed and the cache
+        written, if possible, for next time. Only whole files are cached,
+        so the cache is neither used nor written while a signal selection,
+        start_time or end_time is set, nor for stdin.
+        */
+        bool use_cache;
+
+        /*!
+        @brief Start parsing at the checkpoint of an index nearest to
+        start_time.
+        @details If the file has an up to date index, see VCDFileIndex,
+        the value changes before the last checkpoint at or before
+        start_time are not scanned. The state of every signal at the
+        checkpoint is taken in their place, to be applied at start_time
+        with the changes which follow it. Only used for memory mapped
+        files.
+        */
+        bool use_index;
+
+        /*!
+        @brief Start parsing at the last $dumpall or $dumpvars block
+        before start_time.
+        @details Such a block is taken to list the value of every signal,
+        so nothing before it is needed to know the state at start_time.
+        The body of a memory mapped file is searched for them, which is
+        far quicker than scanning its value changes, and parsing starts at
+        the #time marker of the last one at or before start_time. Off by
+        default: only set it for files whose dump blocks list every
+        signal, as the values of the others would be missing or stale.
+        */
+        bool use_dumps;
+
+        /*!
+        @brief Bytes read at a time from files which are not memory mapped.
+        @details Larger blocks suit network file systems, where each read
+        has a high latency.
+        */
+        size_t read_block_size;
+
+        /*!
+        @brief Number of blocks read ahead of the parser.
+        @details Files which are not memory mapped, such as stdin, pipes
+        and compressed files, are read by a separate thread into a ring
+        of this many blocks while the parser works through earlier ones.
+        0 reads them on the parsing thread instead, except compressed
+        files which always use a ring of at least two blocks.
+        */
+        unsigned read_blocks;
+
+        /*!
+        @brief Number of threads used to parse the value changes.
+        @details Only memory mapped files are parsed in parallel. The body
+        is cut into one chunk per thread at #time markers, but never into
+        chunks smaller than MIN_PARALLEL_CHUNK bytes.
+        */
+        unsigned threads;
+
+        //! Smallest slice of the value changes given to a parsing thread.
+        static const size_t MIN_PARALLEL_CHUNK = 1 << 20;
+
+        //! Most histories kept loaded by a file from parse_lazy().
+        size_t lazy_capacity;
+
+        /*!
+        @brief Ignore anything before this timepoint
+        @details The value changes before it are skipped without being
+        decoded, keeping only the last value of each signal. Those are
+        then applied at start_time, as a $dumpall at start_time would be,
+        so every signal which had a value has one from start_time on.
+        */
         VCDTime start_time;
 
         //! Ignore anything after this timepoint
         VCDTime end_time;
 
+        /*!
+        @brief How far through its input the current parse is.
+        @details Bytes of the file read so far, counting compressed bytes
+        for a compressed file, divided by the size of the file. May be
+        called from another thread while parsing, to display progress.
+        Memory mapped files are scanned in place rather than read, and
+        count as read in full as soon as they are open.
+        @returns A fraction between 0 and 1, or a negative number if the
+        size of the input is unknown, as for a pipe.
+        */
+        double get_progress() const;
+
+        //! Read the next bytes of an input which is not mapped, for the scanner.
+        size_t read_input(char * buffer, size_t size) {
+            return this -> input.read(buffer, size);
+        }
+
         //! Reports errors to stderr.
         void error(const VCDParser::location & l, const std::string & m);
 
@@ -70,31 +292,351 @@ class VCDFileParser {
         //! Current file being parsed and constructed.
         VCDFile * fh;
 
+        //! Receives the contents of the file during parse_events().
+        VCDEventHandler * handler;
+
+        //! Where value changes go: fh, or handler if it is set.
+        VCDEventSink sink;
+
         //! Current stack of scopes being parsed.
         std::stack<VCDScope*> scopes;
 
         //! Current time while parsing the VCD file (moved from global).
         VCDTime current_time;
 
+        /*!
+        @brief Set by the grammar once $enddefinitions has been parsed.
+        @details The grammar stops there and parse_file() continues with
+        the hand written VCDBodyScanner.
+        */
+        bool end_of_header;
+
         //! Location tracker for lexer (moved from static).
         VCDParser::location loc;
 
         //! Wrapper for calling reentrant yylex
         VCDParser::parser::symbol_type get_next_token();
 
+        /*!
+        @brief Keep the text of a vector or real value token until the
+        grammar has applied it.
+        @details The grammar only applies the value once the identifier
+        code after it has been scanned. A memory mapped file is scanned in
+        place and never moves, so the text is referred to where it is.
+        Otherwise flex may reuse its buffer while scanning the code, and
+        the text is copied to value_text, whose storage is kept from one
+        value to the next.
+        */
+        VCDTokenText hold_value(const char * text, size_t length) {
+            if(this -> input.is_mapped()) {
+                return VCDTokenText(text, length);
+            }
+            this -> value_text.assign(text, text + length);
+            return VCDTokenText(this -> value_text.data(), length);
+        }
+
+        /*!
+        @brief Apply a #time marker.
+        @details This and the apply_ methods below hold the rules for what
+        is kept of the value change section, shared by the grammar, the
+        body scanner and the workers of a parallel parse. @p target is
+        sink, or anything else with the add_timestamp() and
+        add_signal_value() methods of VCDFile.
+        @param target in - Where to record the time.
+        @param now in,out - The current time, moved to @p time.
+        @param time in - The time of the marker.
+        @returns false if @p time is past end_time and parsing should stop.
+        */
+        template<typename Target>
+        bool apply_time(Target & target, VCDTime & now, VCDTime time) const {
+            now = time;
+            if(time > this -> end_time) {
+                return false;
+            }
+            if(time >= this -> start_time) {
+                target.add_timestamp(time);
+            }
+            return true;
+        }
+
+        //! Apply a scalar change of signal @p id at time @p now.
+        template<typename Target>
+        void apply_scalar(Target & target, VCDTime now, VCDSignalId id,
+                          VCDBit value) const {
+            if(this -> is_selected(id) && now >= this -> start_time) {
+                target.add_signal_value(id, now, value);
+            }
+        }
+
+        //! Apply a vector change, given by its binary digits, of signal @p id.
+        template<typename Target>
+        void apply_vector(Target & target, VCDTime now, VCDSignalId id,
+                          const char * digits, size_t length) const {
+            if(this -> is_selected(id) && now >= this -> start_time) {
+                target.add_signal_value(id, now, digits, length);
+            }
+        }
+
+        //! Apply a real change, given by its decimal text, of signal @p id.
+        template<typename Target>
+        void apply_real(Target & target, VCDTime now, VCDSignalId id,
+                        const char * text, size_t length) const {
+            if(this -> is_selected(id) && now >= this -> start_time) {
+                target.add_signal_value(id, now, parse_real(text, length));
+            }
+        }
+
+        /*!
+        @brief Apply one token of the value change section.
+        @details Keywords only group value changes and are ignored, as are
+        VCD_BODY_ERROR tokens, which the caller reports.
+        @returns false if the token is a time past end_time.
+        */
+        template<typename Target>
+        bool apply_token(Target & target, VCDTime & now,
+                         const VCDBodyToken & token) const {
+            switch(token.type) {
+                case VCD_BODY_TIME:
+                    return this -> apply_time(target, now, token.time);
+                case VCD_BODY_SCALAR:
+                    this -> apply_scalar(target, now,
+                        this -> fh -> get_signal_id(token.code, token.code_length),
+                        token.bit);
+                    break;
+                case VCD_BODY_VECTOR:
+                    this -> apply_vector(target, now,
+                        this -> fh -> get_signal_id(token.code, token.code_length),
+                        token.text, token.length);
+                    break;
+                case VCD_BODY_REAL:
+                    this -> apply_real(target, now,
+                        this -> fh -> get_signal_id(token.code, token.code_length),
+                        token.text, token.length);
+                    break;
+                default:
+                    break;
+            }
+            return true;
+        }
+
+        /*!
+        @brief Apply the last change of signal @p id before start_time, at
+        start_time.
+        @param token in - The change, as kept by skip_body(). Anything
+        but a value change is ignored.
+        */
+        template<typename Target>
+        void apply_state(Target & target, VCDSignalId id,
+                         const VCDBodyToken & token) const {
+            switch(token.type) {
+                case VCD_BODY_SCALAR:
+                    this -> apply_scalar(target, this -> start_time, id, token.bit);
+                    break;
+                case VCD_BODY_VECTOR:
+                    this -> apply_vector(target, this -> start_time, id,
+                                         token.text, token.length);
+                    break;
+                case VCD_BODY_REAL:
+                    this -> apply_real(target, this -> start_time, id,
+                                       token.text, token.length);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        /*!
+        @brief Apply what skip_body() kept, as a $dumpall at start_time
+        listing it would be, then the marker it stopped at.
+        @param state in - The last change of each signal, indexed by id.
+        @param marker in - The #time marker at which skipping stopped.
+        @returns false if start_time or the marker is past end_time.
+        */
+        template<typename Target>
+        bool apply_skipped(Target & target, VCDTime & now,
+                           const std::vector<VCDBodyToken> & state,
+                           const VCDBodyToken & marker) const {
+            if(!this -> apply_time(target, now, this -> start_time)) {
+                return false;
+            }
+            for(size_t id = 0; id < state.size(); id ++) {
+                this -> apply_state(target, (VCDSignalId)id, state[id]);
+            }
+            return marker.time == this -> start_time ||
+                   this -> apply_time(target, now, marker.time);
+        }
+
+        /*!
+        @brief Convert the text of a real value change into a VCDReal.
+        @details Accepts a sign, a fraction and an exponent, as well as
+        "inf" and "nan". The result is correctly rounded and independent
+        of the locale.
+        @param text in - The number, without the leading 'r'.
+        @param length in - Number of characters in @p text.
+        */
+        static VCDReal parse_real(
+            const char * text,
+            size_t       length
+        );
+
+        /*!
+        @brief Convert a run of decimal digits into a simulation time.
+        @details The caller guarantees every character is a digit, so the
+        loop carries no per-character checks. Values wider than 64 bits
+        wrap.
+        */
+        static VCDTime parse_time(
+            const char * digits,
+            size_t       length
+        ) {
+            VCDTime tr = 0;
+            for(size_t i = 0; i < length; i ++) {
+                tr = tr * 10 + (VCDTime)(digits[i] - '0');
+            }
+            return tr;
+        }
+
     protected:
 
         //! Reentrant scanner state
         yyscan_t scanner;
 
-        //! File handle for input
-        FILE* input_file;
+        //! The file being scanned.
+        VCDInput input;
+
+        //! Copy of the last value token of a stream, see hold_value().
+        std::vector<char> value_text;
+
+        //! Paths passed to select().
+        std::set<std::string> selected_paths;
+
+        //! Patterns passed to select_pattern().
+        std::vector<std::regex> selected_patterns;
+
+        //! Whether each signal id is kept, empty when everything is.
+        std::vector<uint8_t> selection;
+
+        //! Work out which signal ids of fh are selected.
+        void resolve_selection();
+
+        friend class VCDEventReader;
+        friend class VCDFileIndex;
+        friend class VCDSignalLoader;
+
+        //! Parse the header of a file, and unless @p header_only its body.
+        VCDFile * parse(const std::string & filepath, bool header_only);
+
+        /*!
+        @brief Open a file and parse its header into a new fh.
+        @details The file is left open after $enddefinitions, for the value
+        changes to be read with begin_body(), until end_parse().
+        @returns false if the header is malformed.
+        */
+        bool begin_parse(const std::string & filepath);
+
+        /*!
+        @brief Point a body scanner at the value changes.
+        @details Takes over from the flex scanner where the grammar
+        stopped, which must have been at $enddefinitions.
+        */
+        void begin_body(VCDBodyScanner & body);
+
+        //! Number the lines of a body scanner reset to the value changes.
+        void set_body_line(VCDBodyScanner & body) const;
+
+        /*!
+        @brief Close the file opened by begin_parse(), leaving fh alone.
+        @returns false if the input could not be read in full.
+        */
+        bool end_parse();
 
         //! Utility function for starting parsing.
         void scan_begin ();
 
         //! Utility function for stopping parsing.
         void scan_end   ();
+
+        /*!
+        @brief Parse the value change section which follows the header.
+        @details Takes over from the flex scanner where the grammar stopped
+        and feeds value changes straight to fh.
+        @returns false on a syntax error.
+        */
+        bool parse_body ();
+
+        /*!
+        @brief Move the start of a mapped body to a checkpoint of the index
+        of the file.
+        @details Leaves @p data and @p size alone if use_index is not set,
+        or there is no usable checkpoint before start_time.
+        @param data in,out - The value changes still to be scanned.
+        @param size in,out - Number of bytes at @p data.
+        @param state out - The state of the checkpoint, as value changes
+        to be skipped ahead of @p data.
+        */
+        void seek_index (
+            char *      & data,
+            size_t      & size,
+            std::string & state
+        );
+
+        /*!
+        @brief Move the start of a mapped body to the #time marker of the
+        last $dumpall or $dumpvars block at or before start_time.
+        @details Leaves @p data and @p size alone if use_dumps is not set
+        or there is no such block.
+        */
+        void seek_dumps (
+            char * & data,
+            size_t & size
+        );
+
+        /*!
+        @brief Whether the history of signal @p id keeps a value change
+        of the type of @p token, rather than dropping it.
+        */
+        bool accepts(VCDSignalId id, const VCDBodyToken & token) const {
+            const VCDSignalValues * values = this -> fh -> val_map[id];
+            return token.type == VCD_BODY_REAL ? values -> accepts_real()
+                                               : values -> accepts_binary();
+        }
+
+        /*!
+        @brief Skip the value changes before start_time, keeping only the
+        last change of each selected signal.
+        @details Nothing is decoded or stored while skipping. Stops just
+        after the first #time marker at or after start_time, or past
+        end_time, which is left in @p marker. apply_skipped() then applies
+        what was kept.
+        @param body in - Scans the value changes.
+        @param now in,out - The current time, moved to each marker skipped.
+        @param state in,out - The last change of each signal which its
+        history keeps, see accepts(), indexed by id, of type
+        VCD_BODY_COMMAND where there has been none. Only type, bit, text
+        and length are kept.
+        @param copies in,out - If not nullptr, one string per id holding
+        the text of the changes in @p state, for a body read from a stream
+        whose buffer is reused.
+        @param marker out - The marker skipping stopped at, of type
+        VCD_BODY_COMMAND if the value changes ended first.
+        @param message out - Describes a syntax error.
+        @returns false on a syntax error.
+        */
+        bool skip_body (
+            VCDBodyScanner            & body,
+            VCDTime                   & now,
+            std::vector<VCDBodyToken> & state,
+            std::vector<std::string>  * copies,
+            VCDBodyToken              & marker,
+            std::string               & message
+        ) const;
+
+        //! Parse the value changes of a mapped file with several threads.
+        bool parse_body_parallel (
+            const char * data,
+            size_t       size,
+            size_t       chunks
+        );
 };
 
 #endif
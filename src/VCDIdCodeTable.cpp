@@ -0,0 +1,68 @@
+
+#include "VCDIdCodeTable.hpp"
+
+
+/*!
+*/
+VCDIdCodeTable::VCDIdCodeTable(){
+    this -> key_count = 0;
+}
+
+
+/*!
+@details The flat array grows to cover a new key as long as it stays
+within a small multiple of the number of keys stored, so that sequentially
+assigned codes are all resolved by a single array index while a handful
+of sparse codes cannot blow up its size.
+*/
+void VCDIdCodeTable::insert(
+    const char * code,
+    size_t       length,
+    VCDSignalId  id
+){
+    uint64_t key;
+
+    if(!decode(code, length, key)) {
+        this -> by_name[std::string(code, length)] = id;
+        return;
+    }
+
+    if(key < this -> flat.size()) {
+        if(this -> flat[key] == VCD_SIGNAL_ID_NONE) {
+            this -> key_count ++;
+        }
+        this -> flat[key] = id;
+        return;
+    }
+
+    if(key < MAX_FLAT_KEY && key < 8 * (this -> key_count + 1) + 4096) {
+        size_t grow = this -> flat.size() * 2;
+        size_t size = key + 1 > grow ? key + 1 : grow;
+        if(size > MAX_FLAT_KEY) {
+            size = MAX_FLAT_KEY;
+        }
+
+        this -> flat.resize(size, VCD_SIGNAL_ID_NONE);
+
+        // Move previously sparse keys now covered by the flat array.
+        for(auto it = this -> by_key.begin(); it != this -> by_key.end(); ) {
+            if(it -> first < size) {
+                this -> flat[it -> first] = it -> second;
+                it = this -> by_key.erase(it);
+            } else {
+                ++ it;
+            }
+        }
+
+        if(this -> flat[key] == VCD_SIGNAL_ID_NONE) {
+            this -> key_count ++;
+        }
+        this -> flat[key] = id;
+        return;
+    }
+
+    if(this -> by_key.find(key) == this -> by_key.end()) {
+        this -> key_count ++;
+    }
+    this -> by_key[key] = id;
+}
@@ -0,0 +1,126 @@
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "VCDTypes.hpp"
+
+/*!
+@file VCDIdCodeTable.hpp
+@brief Lookup table from VCD identifier codes onto signal ids.
+*/
+
+#ifndef VCDIdCodeTable_HPP
+#define VCDIdCodeTable_HPP
+
+/*!
+@brief Maps VCD identifier codes onto dense signal ids without building
+strings.
+@details Identifier codes are numbers written in base 94 over the
+printable characters '!' to '~'. Codes of up to MAX_KEY_LENGTH characters
+are decoded arithmetically into an integer key, with the first character
+as the least significant digit as most simulators emit them. Small keys
+index a flat array directly, larger keys go through a hash map keyed by
+the integer. Longer codes, or ones using other characters, fall back to a
+hash map keyed by the code string.
+*/
+class VCDIdCodeTable {
+
+    public:
+
+        //! Create an empty table.
+        VCDIdCodeTable();
+
+        //! Longest code which is decoded into an integer key.
+        static const size_t   MAX_KEY_LENGTH = 9;
+
+        //! Keys below this value may be stored in the flat array.
+        static const uint64_t MAX_FLAT_KEY = (uint64_t)1 << 24;
+
+        /*!
+        @brief Decode an identifier code into its integer key.
+        @details Uses bijective numeration (digits 1 to 94) so that codes
+        of different lengths never share a key.
+        @returns false if the code is too long or contains a character
+        outside of '!' to '~'.
+        */
+        static bool decode(
+            const char * code,
+            size_t       length,
+            uint64_t   & key
+        ) {
+            if(length == 0 || length > MAX_KEY_LENGTH) {
+                return false;
+            }
+
+            uint64_t k = 0;
+
+            for(size_t i = length; i > 0; i --) {
+                unsigned d = (unsigned char)code[i - 1] - ('!' - 1);
+                if(d - 1 >= 94) {
+                    return false;
+                }
+                k = k * 94 + d;
+            }
+
+            key = k;
+            return true;
+        }
+
+        /*!
+        @brief Associate an identifier code with a signal id.
+        @details Any previous association of the code is replaced.
+        */
+        void insert(
+            const char * code,
+            size_t       length,
+            VCDSignalId  id
+        );
+
+        /*!
+        @brief Find the signal id of an identifier code.
+        @returns The id, or VCD_SIGNAL_ID_NONE if the code is unknown.
+        */
+        VCDSignalId find(
+            const char * code,
+            size_t       length
+        ) const {
+            uint64_t key;
+
+            if(!decode(code, length, key)) {
+                auto it = this -> by_name.find(std::string(code, length));
+                return it == this -> by_name.end() ? VCD_SIGNAL_ID_NONE
+                                                   : it -> second;
+            }
+
+            if(key < this -> flat.size()) {
+                return this -> flat[key];
+            }
+
+            if(this -> by_key.empty()) {
+                return VCD_SIGNAL_ID_NONE;
+            }
+
+            auto it = this -> by_key.find(key);
+            return it == this -> by_key.end() ? VCD_SIGNAL_ID_NONE
+                                              : it -> second;
+        }
+
+    protected:
+
+        //! Signal ids indexed directly by small keys.
+        std::vector<VCDSignalId> flat;
+
+        //! Number of integer keyed codes stored in the table.
+        size_t key_count;
+
+        //! Signal ids of decodable codes whose keys are too sparse for flat.
+        std::unordered_map<uint64_t, VCDSignalId> by_key;
+
+        //! Signal ids of codes which cannot be decoded into a key.
+        std::unordered_map<std::string, VCDSignalId> by_name;
+};
+
+#endif
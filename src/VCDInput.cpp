@@ -0,0 +1,424 @@
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "VCDInput.hpp"
+
+#ifndef _WIN32
+#define VCD_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#ifndef VCD_NO_ZLIB
+#define VCD_HAVE_ZLIB 1
+#include <zlib.h>
+#endif
+
+
+//! Whether @p magic is the start of a gzip member.
+static bool is_gzip(const char * magic, size_t length) {
+    return length >= 2 && (unsigned char)magic[0] == 0x1f &&
+                          (unsigned char)magic[1] == 0x8b;
+}
+
+
+/*!
+*/
+VCDInput::VCDInput(){
+    this -> stream     = nullptr;
+    this -> map_base   = nullptr;
+    this -> map_size   = 0;
+    this -> map_length = 0;
+    this -> block_size = DEFAULT_BLOCK_SIZE;
+    this -> close();
+}
+
+
+/*!
+*/
+VCDInput::~VCDInput(){
+    this -> close();
+}
+
+
+/*!
+*/
+bool VCDInput::open(
+    const std::string & path,
+    bool                allow_map,
+    size_t              block_size,
+    size_t              blocks
+){
+    this -> close();
+
+    this -> block_size = std::max<size_t>(1, block_size);
+    this -> depth      = blocks;
+
+    if(path.empty() || path == "-") {
+        this -> stream = stdin;
+#ifdef _WIN32
+        // Text mode would turn CRLF into LF, corrupting compressed input.
+        _setmode(_fileno(stdin), _O_BINARY);
+#endif
+        return this -> begin_stream();
+    }
+
+#ifdef VCD_HAVE_MMAP
+    if(allow_map) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0) {
+            return false;
+        }
+
+        struct stat st;
+        char        magic[2];
+
+        if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+           !is_gzip(magic, std::max<ssize_t>(0, pread(fd, magic, 2, 0))) &&
+           this -> map_file(fd, (size_t)st.st_size)) {
+            ::close(fd);
+            this -> bytes_read = st.st_size;
+            this -> file_size  = st.st_size;
+            return true;
+        }
+
+        // Not a regular file, compressed, or it cannot be mapped: stream it.
+        this -> stream = fdopen(fd, "rb");
+        if(!this -> stream) {
+            int err = errno;
+            ::close(fd);
+            errno = err;
+            return false;
+        }
+        return this -> begin_stream();
+    }
+#else
+    (void)allow_map;
+#endif
+
+    // Binary, so that Windows does not translate line ends before a
+    // compressed file is inflated.
+    this -> stream = fopen(path.c_str(), "rb");
+    return this -> stream != nullptr && this -> begin_stream();
+}
+
+
+/*!
+*/
+bool VCDInput::begin_stream(){
+#ifdef VCD_HAVE_MMAP
+    struct stat st;
+    if(fstat(fileno(this -> stream), &st) == 0 && S_ISREG(st.st_mode)) {
+        this -> file_size = st.st_size;
+    }
+#endif
+
+    this -> head_length = fread(this -> head, 1, sizeof(this -> head),
+                                this -> stream);
+    this -> bytes_read  = this -> head_length;
+
+    if(is_gzip(this -> head, this -> head_length)) {
+#ifdef VCD_HAVE_ZLIB
+        this -> compressed = true;
+        this -> depth      = std::max<size_t>(2, this -> depth);
+#else
+        this -> close();
+        errno = ENOTSUP;
+        return false;
+#endif
+    }
+
+    if(this -> depth > 0) {
+        this -> blocks.resize(this -> depth);
+        this -> filled.assign(this -> depth, 0);
+        for(std::vector<char> & block : this -> blocks) {
+            block.resize(this -> block_size);
+        }
+
+        this -> reader = std::thread(&VCDInput::read_ahead, this);
+    }
+
+    return true;
+}
+
+
+/*!
+*/
+void VCDInput::close(){
+    if(this -> reader.joinable()) {
+        this -> stopping = true;
+        {
+            std::lock_guard<std::mutex> guard(this -> lock);
+        }
+        this -> ready.notify_all();
+        this -> reader.join();
+    }
+
+    this -> compressed    = false;
+    this -> depth         = 0;
+    this -> produced      = 0;
+    this -> consumed      = 0;
+    this -> offset        = 0;
+    this -> finished      = false;
+    this -> stopping      = false;
+    this -> read_error    = false;
+
+    this -> head_length   = 0;
+    this -> head_pos      = 0;
+    this -> bytes_read    = 0;
+    this -> file_size     = 0;
+
+#ifdef VCD_HAVE_MMAP
+    if(this -> map_base) {
+        munmap(this -> map_base, this -> map_length);
+    }
+#endif
+    this -> map_base   = nullptr;
+    this -> map_size   = 0;
+    this -> map_length = 0;
+
+    if(this -> stream && this -> stream != stdin) {
+        fclose(this -> stream);
+    }
+    this -> stream = nullptr;
+}
+
+
+/*!
+*/
+size_t VCDInput::read(
+    char * buffer,
+    size_t size
+){
+    if(this -> depth > 0) {
+        return this -> read_ring(buffer, size);
+    }
+    return this -> read_raw(buffer, size);
+}
+
+
+/*!
+*/
+size_t VCDInput::read_raw(
+    char * buffer,
+    size_t size
+){
+    size_t got = 0;
+
+    while(got < size && this -> head_pos < this -> head_length) {
+        buffer[got ++] = this -> head[this -> head_pos ++];
+    }
+
+    if(got < size && this -> stream) {
+        size_t more = fread(buffer + got, 1, size - got, this -> stream);
+        if(more < size - got && ferror(this -> stream)) {
+            this -> read_error = true;
+        }
+        this -> bytes_read += more;
+        got += more;
+    }
+
+    return got;
+}
+
+
+/*!
+@details The reader thread publishes a block by incrementing produced
+after filling it, and only refills it once consumed has moved past it,
+so the data itself needs no lock.
+*/
+size_t VCDInput::read_ring(
+    char * buffer,
+    size_t size
+){
+    size_t next = this -> consumed.load(std::memory_order_relaxed);
+
+    if(this -> produced.load(std::memory_order_acquire) == next) {
+        std::unique_lock<std::mutex> guard(this -> lock);
+        this -> ready.wait(guard, [this, next]() {
+            return this -> produced.load(std::memory_order_acquire) != next ||
+                   this -> finished;
+        });
+        if(this -> produced.load(std::memory_order_acquire) == next) {
+            return 0;
+        }
+    }
+
+    size_t index = next % this -> depth;
+    size_t n     = std::min(size, this -> filled[index] - this -> offset);
+
+    std::memcpy(buffer, this -> blocks[index].data() + this -> offset, n);
+    this -> offset += n;
+
+    if(this -> offset == this -> filled[index]) {
+        this -> offset = 0;
+        this -> consumed.store(next + 1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> guard(this -> lock);
+        }
+        this -> ready.notify_all();
+    }
+
+    return n;
+}
+
+
+/*!
+@details Fills the blocks of the ring in turn, waiting while all of them
+hold data not yet read. Compressed files holding several gzip members one
+after the other, as produced by concatenating compressed files, are
+inflated as one.
+*/
+void VCDInput::read_ahead(){
+    bool ok   = true;
+    bool done = false;
+
+#ifdef VCD_HAVE_ZLIB
+    std::vector<char> in;
+    z_stream          z;
+    bool              between = true;
+
+    if(this -> compressed) {
+        in.resize(this -> block_size);
+        std::memset(&z, 0, sizeof(z));
+
+        // 15 + 16: the largest window, wrapped in a gzip header and trailer.
+        ok   = inflateInit2(&z, 15 + 16) == Z_OK;
+        done = !ok;
+    }
+#endif
+
+    while(!done) {
+        size_t next = this -> produced.load(std::memory_order_relaxed);
+
+        if(next - this -> consumed.load(std::memory_order_acquire) == this -> depth) {
+            std::unique_lock<std::mutex> guard(this -> lock);
+            this -> ready.wait(guard, [this, next]() {
+                return next - this -> consumed.load(std::memory_order_acquire) <
+                       this -> depth || this -> stopping;
+            });
+        }
+        if(this -> stopping) {
+            break;
+        }
+
+        size_t              index = next % this -> depth;
+        std::vector<char> & block = this -> blocks[index];
+        size_t              got   = 0;
+
+        if(!this -> compressed) {
+            got  = this -> read_raw(block.data(), block.size());
+            done = got < block.size();
+            ok   = !this -> read_error;
+        }
+#ifdef VCD_HAVE_ZLIB
+        else {
+            z.next_out  = (Bytef*)block.data();
+            z.avail_out = (uInt)block.size();
+
+            while(z.avail_out > 0) {
+                if(z.avail_in == 0) {
+                    size_t n = this -> read_raw(in.data(), in.size());
+                    if(n == 0) {
+                        // Ending part way through a member means it is truncated.
+                        ok   = between && !this -> read_error;
+                        done = true;
+                        break;
+                    }
+                    z.next_in  = (Bytef*)in.data();
+                    z.avail_in = (uInt)n;
+                }
+
+                int status = inflate(&z, Z_NO_FLUSH);
+                between = false;
+
+                if(status == Z_STREAM_END) {
+                    inflateReset(&z);
+                    between = true;
+                } else if(status != Z_OK && status != Z_BUF_ERROR) {
+                    ok   = false;
+                    done = true;
+                    break;
+                }
+            }
+
+            got = block.size() - z.avail_out;
+        }
+#endif
+
+        if(got > 0) {
+            this -> filled[index] = got;
+            this -> produced.store(next + 1, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> guard(this -> lock);
+            }
+            this -> ready.notify_all();
+        }
+    }
+
+#ifdef VCD_HAVE_ZLIB
+    if(this -> compressed) {
+        inflateEnd(&z);
+    }
+#endif
+
+    if(!ok) {
+        this -> read_error = true;
+    }
+    {
+        std::lock_guard<std::mutex> guard(this -> lock);
+        this -> finished = true;
+    }
+    this -> ready.notify_all();
+}
+
+
+/*!
+@details Reserves anonymous, zero filled, memory for the file plus two
+bytes and maps the file over the start of it. Bytes past the end of the
+file in its last page read as zero too, so the two bytes after the file
+are always NUL whether or not the size is a multiple of the page size.
+*/
+bool VCDInput::map_file(
+    int    fd,
+    size_t size
+){
+#ifdef VCD_HAVE_MMAP
+    size_t page   = (size_t)sysconf(_SC_PAGESIZE);
+    size_t length = (size + 2 + page - 1) / page * page;
+
+    void * base = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED) {
+        return false;
+    }
+
+    if(size > 0) {
+        void * file = mmap(base, size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_FIXED, fd, 0);
+        if(file == MAP_FAILED) {
+            munmap(base, length);
+            return false;
+        }
+
+        madvise(base, size, MADV_SEQUENTIAL);
+    }
+
+    this -> map_base   = (char*)base;
+    this -> map_size   = size;
+    this -> map_length = length;
+
+    return true;
+#else
+    (void)fd;
+    (void)size;
+    return false;
+#endif
+}
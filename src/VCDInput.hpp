@@ -0,0 +1,242 @@
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*!
+@file VCDInput.hpp
+@brief Access to the bytes of a VCD file being parsed.
+*/
+
+#ifndef VCDInput_HPP
+#define VCDInput_HPP
+
+/*!
+@brief Opens a VCD file either as a memory mapping or as a stdio stream.
+@details Regular files are memory mapped, with madvise(MADV_SEQUENTIAL),
+so the scanner can work on the file contents in place instead of copying
+them through read() into its own buffer. The mapping is private and
+writable, and is followed by two NUL bytes, which is the layout flex
+expects of a buffer scanned in place. Standard input, pipes and any file
+which cannot be mapped are read through a FILE* instead.
+
+Streams are read ahead by a separate thread into a ring of blocks, so
+reading overlaps with parsing instead of alternating with it. The ring
+has one producer, the reader thread, and one consumer, read(). They only
+share two counters of the blocks filled and emptied, which are updated
+without locking; a mutex is used solely to sleep on when the ring is
+empty or full.
+
+Files compressed with gzip are recognised by their first two bytes,
+whatever their name, and are never mapped. The reader thread inflates
+them into the ring.
+*/
+class VCDInput {
+
+    public:
+
+        //! Default bytes per block of the read ahead ring.
+        static const size_t DEFAULT_BLOCK_SIZE = 1 << 20;
+
+        //! Default number of blocks in the read ahead ring.
+        static const size_t DEFAULT_BLOCKS = 4;
+
+        //! Create a closed input.
+        VCDInput();
+
+        //! Close the input if it is still open.
+        ~VCDInput();
+
+        /*!
+        @brief Open a file for parsing.
+        @param path in - Path of the file, or "" or "-" for standard input.
+        @param allow_map in - Whether a regular file may be memory mapped.
+        @param block_size in - Bytes per block of the read ahead ring.
+        @param blocks in - Number of blocks in the read ahead ring. 0
+        reads streams on the calling thread instead, except compressed
+        ones, which always have a ring of at least two blocks.
+        @returns false, with errno set, if the file could not be opened.
+        */
+        bool open(
+            const std::string & path,
+            bool                allow_map,
+            size_t              block_size = DEFAULT_BLOCK_SIZE,
+            size_t              blocks     = DEFAULT_BLOCKS
+        );
+
+        //! Unmap or close the input.
+        void close();
+
+        //! Whether the input is being decompressed.
+        bool is_compressed() const {
+            return this -> compressed;
+        }
+
+        //! Whether the input is a memory mapping rather than a stream.
+        bool is_mapped() const {
+            return this -> map_base != nullptr;
+        }
+
+        /*!
+        @brief First byte of the mapped file.
+        @details get_size() bytes of file contents follow, then two NULs.
+        */
+        char * get_data() const {
+            return this -> map_base;
+        }
+
+        //! Size in bytes of the mapped file.
+        size_t get_size() const {
+            return this -> map_size;
+        }
+
+        //! Stream to read from when the input is not mapped.
+        FILE * get_stream() const {
+            return this -> stream;
+        }
+
+        /*!
+        @brief Read the next bytes of an unmapped input.
+        @details Compressed inputs return decompressed bytes.
+        @returns The number of bytes read, 0 at the end of the input.
+        */
+        size_t read(
+            char * buffer,
+            size_t size
+        );
+
+        /*!
+        @brief Bytes of the file read so far.
+        @details Counts compressed bytes for a compressed file, and the
+        whole file once it is mapped. May be called from any thread.
+        */
+        uint64_t get_bytes_read() const {
+            return this -> bytes_read;
+        }
+
+        //! Size of the file in bytes, 0 if unknown as for a pipe.
+        uint64_t get_file_size() const {
+            return this -> file_size;
+        }
+
+        /*!
+        @brief Whether reading failed.
+        @details Set on a read error, or if a compressed input turned out
+        to be corrupt or truncated.
+        */
+        bool failed() const {
+            return this -> read_error;
+        }
+
+    protected:
+
+        //! Stream of an unmapped input, nullptr when mapped or closed.
+        FILE * stream;
+
+        //! Start of the mapping, nullptr when not mapped.
+        char * map_base;
+
+        //! Size of the mapped file.
+        size_t map_size;
+
+        //! Size of the whole mapping, including the trailing NULs.
+        size_t map_length;
+
+        //! Bytes read to recognise the format, returned by read() first.
+        char   head[2];
+
+        //! Number of bytes in head.
+        size_t head_length;
+
+        //! Number of bytes of head already returned.
+        size_t head_pos;
+
+        //! See get_bytes_read().
+        std::atomic<uint64_t> bytes_read;
+
+        //! See get_file_size().
+        std::atomic<uint64_t> file_size;
+
+        //! Whether the stream is inflated by the reader thread.
+        bool   compressed;
+
+        //! Bytes per block of the ring.
+        size_t block_size;
+
+        //! Number of blocks in the ring, 0 when there is no reader thread.
+        size_t depth;
+
+        //! Fills the ring from stream.
+        std::thread reader;
+
+        //! Only held to wait on ready.
+        std::mutex lock;
+
+        //! Signalled when a block is filled or emptied.
+        std::condition_variable ready;
+
+        //! The blocks of the ring, block i % depth is the i-th filled.
+        std::vector<std::vector<char>> blocks;
+
+        //! Number of bytes of each block which hold data.
+        std::vector<size_t> filled;
+
+        //! Number of blocks filled so far, only written by the reader thread.
+        std::atomic<size_t> produced;
+
+        //! Number of blocks emptied so far, only written by read().
+        std::atomic<size_t> consumed;
+
+        //! Bytes of the oldest filled block already returned by read().
+        size_t offset;
+
+        //! Set by the reader thread once it has filled its last block.
+        std::atomic<bool> finished;
+
+        //! Tells the reader thread to stop early.
+        std::atomic<bool> stopping;
+
+        //! See failed().
+        std::atomic<bool> read_error;
+
+        //! Try to map a regular file of @p size bytes.
+        bool map_file(
+            int    fd,
+            size_t size
+        );
+
+        /*!
+        @brief Recognise the format of stream and start the reader thread.
+        @returns false, with errno set, if the format is not supported.
+        */
+        bool begin_stream();
+
+        //! Read the next bytes of stream as they are in the file.
+        size_t read_raw(
+            char * buffer,
+            size_t size
+        );
+
+        //! Read the next bytes from the ring.
+        size_t read_ring(
+            char * buffer,
+            size_t size
+        );
+
+        //! Body of the reader thread.
+        void read_ahead();
+
+    private:
+
+        // Inputs own their mapping or stream and cannot be copied.
+        VCDInput(const VCDInput &);
+        VCDInput & operator= (const VCDInput &);
+};
+
+#endif
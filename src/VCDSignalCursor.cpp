@@ -0,0 +1,49 @@
+
+#include "VCDSignalCursor.hpp"
+
+
+/*!
+*/
+VCDSignalCursor::VCDSignalCursor(
+    const VCDSignalValues * values
+){
+    this -> values = values;
+    this -> count  = 0;
+}
+
+
+/*!
+*/
+bool VCDSignalCursor::seek(
+    VCDTime time
+){
+    this -> count = this -> values -> upper_bound(time);
+    return this -> valid();
+}
+
+
+/*!
+*/
+bool VCDSignalCursor::advance_to(
+    VCDTime time
+){
+    // Most steps move by at most one change, check that before galloping.
+    if(!this -> has_next() || this -> get_next_time() > time) {
+        return this -> valid();
+    }
+
+    this -> count = this -> values -> upper_bound(time, this -> count + 1);
+    return true;
+}
+
+
+/*!
+*/
+bool VCDSignalCursor::next_change(){
+    if(!this -> has_next()) {
+        return false;
+    }
+
+    this -> count ++;
+    return true;
+}
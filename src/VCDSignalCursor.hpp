@@ -0,0 +1,104 @@
+
+#include <cstddef>
+
+#include "VCDTypes.hpp"
+#include "VCDValue.hpp"
+#include "VCDSignalValues.hpp"
+
+/*!
+@file VCDSignalCursor.hpp
+@brief Forward iteration over the history of a single signal.
+*/
+
+#ifndef VCDSignalCursor_HPP
+#define VCDSignalCursor_HPP
+
+/*!
+@brief A read-only position within the history of one signal.
+@details Designed for sequential scans: advance_to() and next_change()
+move forward in amortized O(1) per step, while seek() jumps anywhere in
+O(log n). A cursor never modifies the history it is bound to, so any
+number of cursors, in any number of threads, may scan the same parsed
+VCDFile concurrently.
+
+The cursor always sits on the last change at or before its position. It
+starts before the first change, where valid() is false.
+*/
+class VCDSignalCursor {
+
+    public:
+
+        /*!
+        @brief Create a cursor positioned before the first change.
+        @param values in - The history to scan, which must outlive the
+        cursor and must not be appended to while the cursor is used.
+        */
+        VCDSignalCursor(
+            const VCDSignalValues * values
+        );
+
+        /*!
+        @brief Position the cursor on the value of the signal at @p time.
+        @returns valid()
+        */
+        bool seek(
+            VCDTime time
+        );
+
+        /*!
+        @brief Move the cursor forward to the value of the signal at @p time.
+        @details Gallops from the current change, so advancing by a few
+        changes costs a few comparisons. Times earlier than the current
+        change leave the cursor where it is.
+        @returns valid()
+        */
+        bool advance_to(
+            VCDTime time
+        );
+
+        /*!
+        @brief Move the cursor onto the next change of the signal.
+        @returns false, leaving the cursor in place, if there is none.
+        */
+        bool next_change();
+
+        //! Whether the cursor sits on a change, i.e. the signal has a value.
+        bool valid() const {
+            return this -> count > 0;
+        }
+
+        //! Whether there is a change after the current one.
+        bool has_next() const {
+            return this -> count < this -> values -> size();
+        }
+
+        //! Index within the history of the current change, if valid().
+        size_t get_index() const {
+            return this -> count - 1;
+        }
+
+        //! Time of the current change, if valid().
+        VCDTime get_time() const {
+            return this -> values -> get_time(this -> count - 1);
+        }
+
+        //! Time of the next change, if has_next().
+        VCDTime get_next_time() const {
+            return this -> values -> get_time(this -> count);
+        }
+
+        //! Value of the current change, if valid().
+        VCDValue get_value() const {
+            return this -> values -> get_value(this -> count - 1);
+        }
+
+    protected:
+
+        //! The history being scanned.
+        const VCDSignalValues * values;
+
+        //! Number of changes at or before the cursor.
+        size_t count;
+};
+
+#endif
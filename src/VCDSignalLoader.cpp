@@ -0,0 +1,329 @@
+
+#include <algorithm>
+#include <limits>
+
+#include "VCDSignalLoader.hpp"
+
+
+/*!
+@brief Where a load records value changes.
+@details The timestamps of the file were recorded when it was opened, so
+only the changes of the signals being loaded are added.
+*/
+struct VCDLoadTarget {
+
+    VCDFile * file;
+
+    void add_timestamp(VCDTime) {
+    }
+
+    void add_signal_value(VCDSignalId id, VCDTime time, VCDBit value) {
+        this -> file -> add_signal_value(id, time, value);
+    }
+
+    void add_signal_value(VCDSignalId id, VCDTime time,
+                          const char * digits, size_t length) {
+        this -> file -> add_signal_value(id, time, digits, length);
+    }
+
+    void add_signal_value(VCDSignalId id, VCDTime time, VCDReal value) {
+        this -> file -> add_signal_value(id, time, value);
+    }
+};
+
+
+/*!
+*/
+VCDSignalLoader::VCDSignalLoader(
+    VCDFileParser & parser,
+    const char    * data,
+    size_t          size,
+    size_t          capacity
+){
+    this -> file     = parser.fh;
+    this -> ready    = false;
+    this -> body_end = 0;
+    this -> capacity = std::max<size_t>(1, capacity);
+    this -> allowed  = parser.selection;
+
+    this -> rules.filepath     = parser.filepath;
+    this -> rules.start_time   = parser.start_time;
+    this -> rules.end_time     = parser.end_time;
+    this -> rules.current_time = parser.current_time;
+    this -> rules.fh           = parser.fh;
+
+    size_t ids = this -> file -> get_signal_id_count();
+
+    this -> loaded.assign(ids, 0);
+    this -> position.resize(ids);
+
+    // The mapping of the parser goes once it is done with the header, so
+    // the file is mapped again, where the body is at the same offset.
+    size_t offset = data - parser.input.get_data();
+
+    if(!this -> rules.input.open(parser.filepath, true) ||
+       !this -> rules.input.is_mapped() ||
+       this -> rules.input.get_size() != parser.input.get_size()) {
+        parser.error("Cannot map " + parser.filepath + " to load it lazily");
+        return;
+    }
+
+    this -> ready = this -> index(this -> rules.input.get_data() + offset, size);
+}
+
+
+/*!
+@details Only the identifier codes of value changes are looked at, the
+values themselves are skipped.
+*/
+bool VCDSignalLoader::index(
+    const char * data,
+    size_t       size
+){
+    const char * base = this -> rules.input.get_data();
+    size_t       ids  = this -> file -> get_signal_id_count();
+
+    VCDBodyScanner body;
+    VCDBodyToken   token;
+    body.reset(data, size);
+    body.set_line(base, 1);
+
+    // No signal changes in any chunk if the window is empty.
+    this -> first.assign(ids + 1, 0);
+
+    VCDTime now = this -> rules.current_time;
+
+    // The state at start_time refers to the mapping, and is applied to
+    // each signal as it is loaded.
+    if(this -> rules.start_time != std::numeric_limits<VCDTime>::min()) {
+        VCDBodyToken none;
+        none.type = VCD_BODY_COMMAND;
+        this -> state.assign(ids, none);
+
+        std::string message;
+
+        if(!this -> rules.skip_body(body, now, this -> state, nullptr,
+                                    token, message)) {
+            this -> rules.error(message);
+            return false;
+        }
+
+        // As VCDFileParser::apply_skipped(), leaving out the state.
+        if(token.type != VCD_BODY_TIME ||
+           !this -> rules.apply_time(*this -> file, now, this -> rules.start_time)) {
+            this -> state.clear();
+            return true;
+        }
+        if(token.time != this -> rules.start_time &&
+           !this -> rules.apply_time(*this -> file, now, token.time)) {
+            return true;
+        }
+    }
+
+    // Values before the first #time belong to the current time.
+    const char * before = body.get_position();
+
+    Chunk chunk;
+    chunk.offset = before - base;
+    chunk.now    = now;
+
+    this -> chunks.push_back(chunk);
+
+    this -> body_end = data + size - base;
+
+    // Signals changing in each chunk, those of chunk c from seen[spans[c]].
+    std::vector<VCDSignalId> seen;
+    std::vector<size_t>      spans(1, 0);
+    std::vector<uint32_t>    last(ids, std::numeric_limits<uint32_t>::max());
+    uint32_t                 current = 0;
+    bool                     more    = true;
+
+    while(more && body.next(token)) {
+        VCDSignalId id;
+
+        switch(token.type) {
+            case VCD_BODY_TIME:
+                if((size_t)(before - base) - this -> chunks.back().offset >= CHUNK_SIZE) {
+                    chunk.offset = before - base;
+                    chunk.now    = now;
+                    this -> chunks.push_back(chunk);
+                    spans.push_back(seen.size());
+                    current ++;
+                }
+                if(!this -> rules.apply_time(*this -> file, now, token.time)) {
+                    this -> body_end = before - base;
+                    more = false;
+                }
+                break;
+
+            case VCD_BODY_SCALAR:
+            case VCD_BODY_VECTOR:
+            case VCD_BODY_REAL:
+                id = this -> file -> get_signal_id(token.code, token.code_length);
+                if(id != VCD_SIGNAL_ID_NONE && last[id] != current &&
+                   (this -> allowed.empty() || this -> allowed[id])) {
+                    last[id] = current;
+                    seen.push_back(id);
+                    this -> first[id + 1] ++;
+                }
+                break;
+
+            case VCD_BODY_ERROR:
+                this -> rules.error(body.syntax_error(token));
+                return false;
+
+            default:
+                break;
+        }
+
+        before = body.get_position();
+    }
+
+    // Regroup the chunk of every change by signal, keeping chunk order.
+    for(size_t id = 0; id < ids; id ++) {
+        this -> first[id + 1] += this -> first[id];
+    }
+
+    std::vector<size_t> next(this -> first.begin(), this -> first.end() - 1);
+
+    this -> changes.resize(seen.size());
+    spans.push_back(seen.size());
+
+    for(uint32_t c = 0; c + 1 < spans.size(); c ++) {
+        for(size_t i = spans[c]; i < spans[c + 1]; i ++) {
+            this -> changes[next[seen[i]] ++] = c;
+        }
+    }
+
+    return true;
+}
+
+
+/*!
+*/
+void VCDSignalLoader::touch(
+    VCDSignalId id
+){
+    this -> recent.splice(this -> recent.begin(), this -> recent,
+                          this -> position[id]);
+}
+
+
+/*!
+*/
+void VCDSignalLoader::evict(
+    size_t keep
+){
+    // Not through get_signal_values(), which would load it again.
+    while(this -> recent.size() > keep) {
+        VCDSignalId id = this -> recent.back();
+        this -> recent.pop_back();
+        this -> loaded[id] = 0;
+        this -> file -> val_map[id] -> clear();
+    }
+}
+
+
+/*!
+@details The chunk lists of the signals are merged, so the chunks in
+which none of them change are skipped, and the others are scanned once
+between them, however many signals there are. Signals which are not selected are marked as loaded without ever
+being scanned for, leaving their histories empty.
+*/
+void VCDSignalLoader::load(
+    const std::vector<VCDSignalId> & ids
+){
+    std::lock_guard<std::mutex> guard(this -> lock);
+
+    std::vector<VCDSignalId> wanted;
+    size_t                   batch = 0;
+
+    for(VCDSignalId id : ids) {
+        if(id >= this -> loaded.size()) {
+            continue;
+        }
+        if(this -> loaded[id]) {
+            this -> touch(id);
+        } else {
+            this -> loaded[id] = 1;
+            this -> recent.push_front(id);
+            this -> position[id] = this -> recent.begin();
+
+            if(this -> allowed.empty() || this -> allowed[id]) {
+                wanted.push_back(id);
+            }
+        }
+        batch ++;
+    }
+
+    if(this -> ready && !wanted.empty()) {
+        // The value change rules keep exactly the signals being loaded.
+        this -> rules.selection.assign(this -> loaded.size(), 0);
+        for(VCDSignalId id : wanted) {
+            this -> rules.selection[id] = 1;
+        }
+
+        const char  * base = this -> rules.input.get_data();
+        VCDLoadTarget target;
+        target.file = this -> file;
+
+        if(!this -> state.empty()) {
+            for(VCDSignalId id : wanted) {
+                this -> rules.apply_state(target, id, this -> state[id]);
+            }
+        }
+
+        std::vector<uint8_t> scan(this -> chunks.size(), 0);
+
+        for(VCDSignalId id : wanted) {
+            for(size_t i = this -> first[id]; i < this -> first[id + 1]; i ++) {
+                scan[this -> changes[i]] = 1;
+            }
+        }
+
+        for(size_t c = 0; c < this -> chunks.size(); c ++) {
+            if(!scan[c]) {
+                continue;
+            }
+
+            size_t end = c + 1 < this -> chunks.size() ?
+                         this -> chunks[c + 1].offset : this -> body_end;
+
+            VCDBodyScanner body;
+            VCDBodyToken   token;
+            VCDTime        now = this -> chunks[c].now;
+
+            body.reset(base + this -> chunks[c].offset,
+                       end - this -> chunks[c].offset);
+
+            // Checked for errors and end_time when the file was opened.
+            while(body.next(token)) {
+                this -> rules.apply_token(target, now, token);
+            }
+        }
+    }
+
+    // A batch larger than the capacity is kept whole until the next load.
+    this -> evict(std::max(this -> capacity, batch));
+}
+
+
+/*!
+*/
+void VCDSignalLoader::load(
+    VCDSignalId id
+){
+    {
+        std::lock_guard<std::mutex> guard(this -> lock);
+
+        if(id >= this -> loaded.size()) {
+            return;
+        }
+        if(this -> loaded[id]) {
+            this -> touch(id);
+            return;
+        }
+    }
+
+    this -> load(std::vector<VCDSignalId>(1, id));
+}
@@ -0,0 +1,150 @@
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "VCDTypes.hpp"
+#include "VCDFileParser.hpp"
+
+/*!
+@file VCDSignalLoader.hpp
+@brief Loads the value changes of signals of a VCD file when first asked for.
+*/
+
+#ifndef VCDSignalLoader_HPP
+#define VCDSignalLoader_HPP
+
+/*!
+@brief Fills the histories of a file from VCDFileParser::parse_lazy() on
+demand.
+@details When the file is opened the value changes are scanned once,
+without decoding anything. The scan records the timestamps of the file,
+cuts the value changes into chunks of about CHUNK_SIZE bytes at #time
+markers, and notes the chunks in which each signal changes. Only the
+chunks a signal changes in are listed, so the notes grow with the number
+of changes rather than with chunks times signals. The file stays mapped.
+
+The history of a signal is then decoded the first time it is asked for,
+by VCDFile::get_signal_values() or the queries built on it, by scanning
+just the chunks in which it changes. VCDFile::load_signal_values() loads
+several signals with a single scan.
+
+At most a fixed number of histories are kept loaded. Loading more than
+that empties the least recently used ones, which are loaded again if
+they are asked for later. The history objects themselves are never
+freed, so pointers to them stay valid, but an emptied history reads as
+having no changes until it is asked for through the file again.
+*/
+class VCDSignalLoader {
+
+    public:
+
+        //! Approximate size of the chunks of the value changes.
+        static const size_t CHUNK_SIZE = 4 << 20;
+
+        /*!
+        @brief Scan the value changes of a file being parsed lazily.
+        @param parser in - The parser, which has parsed the header of a
+        memory mapped file into parser.fh. Its options, time range and
+        signal selection apply to the histories loaded.
+        @param data in - The value changes, within the mapping of parser.
+        @param size in - Number of bytes at @p data.
+        @param capacity in - Most histories kept loaded at once.
+        */
+        VCDSignalLoader(
+            VCDFileParser & parser,
+            const char    * data,
+            size_t          size,
+            size_t          capacity
+        );
+
+        //! Whether the value changes were scanned without error.
+        bool is_ready() const {
+            return this -> ready;
+        }
+
+        /*!
+        @brief Load the histories of signals which are not loaded.
+        @details Marks all of them as most recently used.
+        */
+        void load(
+            const std::vector<VCDSignalId> & ids
+        );
+
+        //! Load the history of one signal, see load().
+        void load(
+            VCDSignalId id
+        );
+
+    protected:
+
+        //! A slice of the value changes starting at a #time marker.
+        struct Chunk {
+            size_t  offset;     //!< Start of the slice in the mapping.
+            VCDTime now;        //!< Current time at the start of the slice.
+        };
+
+        //! The file whose histories are loaded.
+        VCDFile               * file;
+
+        //! Holds the value change rules and the mapping of the file.
+        VCDFileParser           rules;
+
+        //! Whether each signal is selected by the options of the parse.
+        std::vector<uint8_t>    allowed;
+
+        //! Whether the scan on opening succeeded.
+        bool                    ready;
+
+        //! Last change of each signal before start_time, see VCDFileParser::skip_body().
+        std::vector<VCDBodyToken> state;
+
+        //! Chunks of the value changes, in file order.
+        std::vector<Chunk>      chunks;
+
+        //! Offset in the mapping of the end of the last chunk.
+        size_t                  body_end;
+
+        //! Start of the chunks of each signal in changes, and their end.
+        std::vector<size_t>     first;
+
+        //! Chunks in which signal id changes, ascending, from first[id] to first[id + 1].
+        std::vector<uint32_t>   changes;
+
+        //! See the constructor.
+        size_t                  capacity;
+
+        //! Loaded signals, most recently used first.
+        std::list<VCDSignalId>  recent;
+
+        //! Position of each loaded signal in recent.
+        std::vector<std::list<VCDSignalId>::iterator> position;
+
+        //! Whether each signal is loaded.
+        std::vector<uint8_t>    loaded;
+
+        //! Serialises loading.
+        std::mutex              lock;
+
+        //! Scan the value changes, filling chunks, changes and the timestamps.
+        bool index(
+            const char * data,
+            size_t       size
+        );
+
+        //! Move a loaded signal to the front of recent.
+        void touch(VCDSignalId id);
+
+        //! Unload the least recently used signals beyond the @p keep most recent.
+        void evict(size_t keep);
+
+    private:
+
+        VCDSignalLoader(const VCDSignalLoader &);
+        VCDSignalLoader & operator= (const VCDSignalLoader &);
+};
+
+#endif
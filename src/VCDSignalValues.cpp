@@ -0,0 +1,206 @@
+
+#include <algorithm>
+
+#include "VCDSignalValues.hpp"
+
+
+/*!
+*/
+VCDSignalValues::VCDSignalValues(
+    VCDValueType  type,
+    VCDSignalSize width
+){
+    this -> type     = type;
+    this -> width    = width;
+    this -> stride   = 0;
+    this -> borrowed = false;
+
+    if(type == VCD_VECTOR) {
+        this -> stride = 2 * VCDValue::words_for_width(width);
+    }
+}
+
+
+/*!
+*/
+void VCDSignalValues::update_views(){
+    this -> time_view   = VCDSpan<VCDTime>(this -> times.data(), this -> times.size());
+    this -> scalar_view = VCDSpan<uint8_t>(this -> scalars.data(), this -> scalars.size());
+    this -> word_view   = VCDSpan<uint64_t>(this -> words.data(), this -> words.size());
+    this -> real_view   = VCDSpan<VCDReal>(this -> reals.data(), this -> reals.size());
+}
+
+
+/*!
+*/
+void VCDSignalValues::own(){
+    if(!this -> borrowed) {
+        return;
+    }
+
+    this -> times.assign(this -> time_view.begin(), this -> time_view.end());
+    this -> scalars.assign(this -> scalar_view.begin(), this -> scalar_view.end());
+    this -> words.assign(this -> word_view.begin(), this -> word_view.end());
+    this -> reals.assign(this -> real_view.begin(), this -> real_view.end());
+    this -> borrowed = false;
+}
+
+
+/*!
+*/
+void VCDSignalValues::refer(
+    VCDSpan<VCDTime>  times,
+    VCDSpan<uint8_t>  scalars,
+    VCDSpan<uint64_t> words,
+    VCDSpan<VCDReal>  reals
+){
+    std::vector<VCDTime>().swap(this -> times);
+    std::vector<uint8_t>().swap(this -> scalars);
+    std::vector<uint64_t>().swap(this -> words);
+    std::vector<VCDReal>().swap(this -> reals);
+
+    this -> time_view   = times;
+    this -> scalar_view = this -> type == VCD_SCALAR ? scalars : VCDSpan<uint8_t>();
+    this -> word_view   = this -> type == VCD_VECTOR ? words   : VCDSpan<uint64_t>();
+    this -> real_view   = this -> type == VCD_REAL   ? reals   : VCDSpan<VCDReal>();
+    this -> borrowed    = true;
+}
+
+
+/*!
+*/
+void VCDSignalValues::clear(){
+    std::vector<VCDTime>().swap(this -> times);
+    std::vector<uint8_t>().swap(this -> scalars);
+    std::vector<uint64_t>().swap(this -> words);
+    std::vector<VCDReal>().swap(this -> reals);
+    this -> borrowed = false;
+    this -> update_views();
+}
+
+
+/*!
+*/
+VCDValue VCDSignalValues::get_value(size_t index) const {
+    switch(this -> type) {
+        case VCD_SCALAR:
+            return VCDValue((VCDBit)this -> scalar_view[index]);
+        case VCD_REAL:
+            return VCDValue(this -> real_view[index]);
+        case VCD_VECTOR:
+        default:
+            return VCDValue(this -> width,
+                            this -> word_view.data() + index * this -> stride);
+    }
+}
+
+
+/*!
+*/
+size_t VCDSignalValues::upper_bound(
+    VCDTime time
+) const {
+    return std::upper_bound(this -> time_view.begin(), this -> time_view.end(), time)
+         - this -> time_view.begin();
+}
+
+
+/*!
+*/
+size_t VCDSignalValues::upper_bound(
+    VCDTime time,
+    size_t  hint
+) const {
+    const VCDTime * times = this -> time_view.data();
+    size_t          n     = this -> time_view.size();
+    size_t          lo    = hint;
+    size_t          step  = 1;
+
+    // Find hi such that times[hi] > time, doubling the step each time.
+    while(lo + step <= n && times[lo + step - 1] <= time) {
+        lo   += step;
+        step *= 2;
+    }
+
+    size_t hi = std::min(lo + step, n);
+
+    return std::upper_bound(times + lo, times + hi, time) - times;
+}
+
+
+/*!
+@details A scalar change on a vector signal is treated as a one digit
+binary literal.
+*/
+void VCDSignalValues::append_scalar(
+    VCDTime time,
+    VCDBit  value
+){
+    if(this -> type == VCD_SCALAR) {
+        this -> own();
+        this -> times.push_back(time);
+        this -> scalars.push_back((uint8_t)value);
+        this -> update_views();
+    } else if(this -> type == VCD_VECTOR) {
+        static const char digits[] = {'0', '1', 'x', 'z'};
+        this -> append_vector(time, &digits[value & 3], 1);
+    }
+}
+
+
+/*!
+@details A vector change on a scalar signal keeps its least significant
+digit.
+*/
+void VCDSignalValues::append_vector(
+    VCDTime      time,
+    const char * digits,
+    size_t       length
+){
+    if(this -> type == VCD_VECTOR) {
+        this -> own();
+        size_t base = this -> words.size();
+        this -> words.resize(base + this -> stride);
+        VCDValue::decode_binary(digits, length, this -> width,
+                                this -> words.data() + base);
+        this -> times.push_back(time);
+        this -> update_views();
+    } else if(this -> type == VCD_SCALAR && length > 0) {
+        uint64_t planes[2];
+        VCDValue::decode_binary(digits + length - 1, 1, 1, planes);
+        this -> append_scalar(time, (VCDBit)(planes[0] | (planes[1] << 1)));
+    }
+}
+
+
+/*!
+*/
+void VCDSignalValues::append_real(
+    VCDTime time,
+    VCDReal value
+){
+    if(this -> accepts_real()) {
+        this -> own();
+        this -> times.push_back(time);
+        this -> reals.push_back(value);
+        this -> update_views();
+    }
+}
+
+
+/*!
+*/
+void VCDSignalValues::append(
+    const VCDSignalValues & other
+){
+    this -> own();
+    this -> times.insert(this -> times.end(),
+                         other.time_view.begin(), other.time_view.end());
+    this -> scalars.insert(this -> scalars.end(),
+                           other.scalar_view.begin(), other.scalar_view.end());
+    this -> words.insert(this -> words.end(),
+                         other.word_view.begin(), other.word_view.end());
+    this -> reals.insert(this -> reals.end(),
+                         other.real_view.begin(), other.real_view.end());
+    this -> update_views();
+}
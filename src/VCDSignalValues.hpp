@@ -0,0 +1,238 @@
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "VCDTypes.hpp"
+#include "VCDValue.hpp"
+
+/*!
+@file VCDSignalValues.hpp
+@brief Columnar storage of the value history of a single signal.
+*/
+
+#ifndef VCDSignalValues_HPP
+#define VCDSignalValues_HPP
+
+/*!
+@brief The time-ordered history of values taken by one signal.
+@details Stored as a structure of arrays: one contiguous array holds the
+timestamps and a second one holds the packed values, so scans and searches
+over a history stream through memory rather than chasing pointers.
+
+The representation of the value array depends on the value type of the
+signal, fixed when the history is created from the signal declaration:
+ - VCD_SCALAR: one byte per change, holding a VCDBit.
+ - VCD_VECTOR: get_stride() words per change, the value bit-plane
+   followed by the unknown bit-plane as described for VCDValue.
+ - VCD_REAL: one VCDReal per change.
+
+Changes which do not fit the declared type are converted where the VCD
+standard defines how (scalars and vectors) and dropped otherwise.
+
+A history may also refer to columns it does not own, such as those of a
+file loaded by VCDFileCache, see refer(). It is then copied into storage
+of its own the first time it is appended to.
+*/
+class VCDSignalValues {
+
+    public:
+
+        /*!
+        @brief Create an empty history.
+        @param type in - Representation of every value in the history.
+        @param width in - Width in bits of vector values.
+        */
+        VCDSignalValues(
+            VCDValueType  type,
+            VCDSignalSize width
+        );
+
+        //! The type of every value in the history.
+        VCDValueType     get_type() const {
+            return this -> type;
+        }
+
+        //! Width in bits of the values in the history.
+        VCDSignalSize    get_width() const {
+            return this -> width;
+        }
+
+        //! Number of words per change in get_words(), for vectors.
+        size_t           get_stride() const {
+            return this -> stride;
+        }
+
+        //! Number of value changes in the history.
+        size_t           size() const {
+            return this -> time_view.size();
+        }
+
+        //! Whether the history holds no value changes.
+        bool             empty() const {
+            return this -> time_view.empty();
+        }
+
+        //! Whether append_scalar() and append_vector() keep changes.
+        bool             accepts_binary() const {
+            return this -> type == VCD_SCALAR || this -> type == VCD_VECTOR;
+        }
+
+        //! Whether append_real() keeps changes.
+        bool             accepts_real() const {
+            return this -> type == VCD_REAL;
+        }
+
+        //! Time of every change, sorted ascending.
+        VCDSpan<VCDTime> get_times() const {
+            return this -> time_view;
+        }
+
+        //! Value of every change of a VCD_SCALAR history.
+        VCDSpan<uint8_t> get_scalars() const {
+            return this -> scalar_view;
+        }
+
+        //! Packed bit-planes of every change of a VCD_VECTOR history.
+        VCDSpan<uint64_t> get_words() const {
+            return this -> word_view;
+        }
+
+        //! Value of every change of a VCD_REAL history.
+        VCDSpan<VCDReal> get_reals() const {
+            return this -> real_view;
+        }
+
+        //! Time of change @p index.
+        VCDTime          get_time(size_t index) const {
+            return this -> time_view[index];
+        }
+
+        /*!
+        @brief Value of change @p index.
+        @details Vectors wider than 64 bits refer to the storage of the
+        history rather than copying it; they must not be modified and are
+        valid until the history is next changed.
+        */
+        VCDValue         get_value(size_t index) const;
+
+        /*!
+        @brief Number of changes at or before @p time.
+        @details Binary search over the timestamps. The value of the signal
+        at @p time is get_value(n - 1), or undefined if n is 0.
+        */
+        size_t           upper_bound(
+            VCDTime time
+        ) const;
+
+        /*!
+        @brief Number of changes at or before @p time, searching forward
+        from a previous result.
+        @details Gallops forward from @p hint and then binary searches the
+        bracketed range, so a sequence of increasing queries costs
+        O(log distance) each rather than O(log size()).
+        @param time in - The time to search for.
+        @param hint in - A previous result for a time no later than @p time.
+        */
+        size_t           upper_bound(
+            VCDTime time,
+            size_t  hint
+        ) const;
+
+        //! Append a scalar value change.
+        void append_scalar(
+            VCDTime time,
+            VCDBit  value
+        );
+
+        /*!
+        @brief Append a vector value change.
+        @param time in - Time of the change.
+        @param digits in - Binary digits of the value, most significant first.
+        @param length in - Number of digits.
+        */
+        void append_vector(
+            VCDTime      time,
+            const char * digits,
+            size_t       length
+        );
+
+        //! Append a real value change.
+        void append_real(
+            VCDTime time,
+            VCDReal value
+        );
+
+        /*!
+        @brief Append every change of another history of the same type and
+        width.
+        @details Used to join histories parsed separately from consecutive
+        parts of a file. The changes of @p other must all be at or after
+        the last change of this history.
+        */
+        void append(
+            const VCDSignalValues & other
+        );
+
+        /*!
+        @brief Refer to columns held elsewhere instead of storing changes.
+        @details Replaces the history. The columns are laid out as those
+        returned by get_times() and the value getters, and must stay valid
+        for as long as the history refers to them. Only the value column
+        of the type of the history is used.
+        */
+        void refer(
+            VCDSpan<VCDTime>  times,
+            VCDSpan<uint8_t>  scalars,
+            VCDSpan<uint64_t> words,
+            VCDSpan<VCDReal>  reals
+        );
+
+        //! Remove every change, releasing the memory of the history.
+        void clear();
+
+        //! Whether the history refers to columns it does not own.
+        bool is_borrowed() const {
+            return this -> borrowed;
+        }
+
+    protected:
+
+        //! The type of every value in the history.
+        VCDValueType          type;
+
+        //! Width in bits of the values in the history.
+        VCDSignalSize         width;
+
+        //! Words per change of a vector history.
+        size_t                stride;
+
+        //! Time of each change.
+        std::vector<VCDTime>  times;
+
+        //! Values of a VCD_SCALAR history.
+        std::vector<uint8_t>  scalars;
+
+        //! Values of a VCD_VECTOR history, stride words per change.
+        std::vector<uint64_t> words;
+
+        //! Values of a VCD_REAL history.
+        std::vector<VCDReal>  reals;
+
+        //! Whether the views below refer to columns set by refer().
+        bool                  borrowed;
+
+        //! The columns read by the getters, the vectors above unless borrowed.
+        VCDSpan<VCDTime>      time_view;
+        VCDSpan<uint8_t>      scalar_view;
+        VCDSpan<uint64_t>     word_view;
+        VCDSpan<VCDReal>      real_view;
+
+        //! Point the views at the vectors after they have changed.
+        void update_views();
+
+        //! Copy borrowed columns into the vectors before changing them.
+        void own();
+};
+
+#endif
@@ -1,9 +1,9 @@
 
+#include <cstdint>
 #include <map>
 #include <utility>
 #include <string>
 #include <vector>
-#include <deque>
 
 /*!
 @file VCDTypes.hpp
@@ -22,8 +22,24 @@ typedef std::string VCDScopeName;
 //! Compressed hash representation of a signal.
 typedef std::string VCDSignalHash;
 
-//! Represents a single instant in time in a trace
-typedef double VCDTime;
+//! Dense index of a signal within a VCDFile, assigned as $var is parsed.
+typedef uint32_t VCDSignalId;
+
+//! Signal index used for identifier codes which were never declared.
+const VCDSignalId VCD_SIGNAL_ID_NONE = 0xFFFFFFFF;
+
+//! Marks what is kept only so that code written for older releases builds.
+#if defined(__GNUC__) || defined(__clang__)
+#define VCD_DEPRECATED(message) __attribute__((deprecated(message)))
+#elif defined(_MSC_VER)
+#define VCD_DEPRECATED(message) __declspec(deprecated(message))
+#else
+#define VCD_DEPRECATED(message)
+#endif
+
+//! Represents a single instant in time in a trace, in units of the
+//! file timescale. See VCDFile::get_time_seconds() for real time.
+typedef uint64_t VCDTime;
 
 //! Specifies the timing resoloution along with VCDTimeUnit
 typedef unsigned VCDTimeRes;
@@ -50,7 +66,7 @@ typedef double VCDReal;
 //! Describes how a signal value is represented in the VCD trace.
 typedef enum {
     VCD_SCALAR, //!< Single VCDBit
-    VCD_VECTOR, //!< Vector of VCDBit
+    VCD_VECTOR, //!< Packed four-state vector of bits
     VCD_REAL    //!< IEEE Floating point (64bit).
 } VCDValueType;
 
@@ -59,15 +75,37 @@ typedef enum {
 class VCDValue;
 
 
-//! A signal value tagged with times.
-typedef struct {
-    VCDTime     time;
-    VCDValue  * value;
-} VCDTimedValue;
+// Forward declaration of the per-signal history of time/value pairs.
+class VCDSignalValues;
+
+
+//! A read-only view of a contiguous array, such as a column of a history.
+template<typename T>
+class VCDSpan {
+
+    public:
+
+        VCDSpan() : ptr(nullptr), count(0) {}
+
+        VCDSpan(const T * data, size_t size) : ptr(data), count(size) {}
+
+        const T * data()  const { return ptr; }
+        size_t    size()  const { return count; }
+        bool      empty() const { return count == 0; }
+        const T * begin() const { return ptr; }
+        const T * end()   const { return ptr + count; }
+
+        const T & operator[] (size_t i) const { return ptr[i]; }
+
+    protected:
+
+        const T * ptr;
+        size_t    count;
+};
 
 
-//! A vector of tagged time/value pairs, sorted by time values.
-typedef std::deque<VCDTimedValue*> VCDSignalValues;
+//! Characters of a token in the input, not NUL terminated.
+typedef VCDSpan<char> VCDTokenText;
 
 
 //! Variable types of a signal in a VCD file.
@@ -100,6 +138,7 @@ typedef enum {
     TIME_US,    //!< Microseconds
     TIME_NS,    //!< Nanoseconds
     TIME_PS,    //!< Picoseconds
+    TIME_FS,    //!< Femtoseconds
 } VCDTimeUnit;
 
 
@@ -120,6 +159,7 @@ typedef struct vcdscope VCDScope;
 //! Represents a single signal reference within a VCD file
 typedef struct {
     VCDSignalHash       hash;
+    VCDSignalId         id;     // Shared by all signals with the same hash
     VCDSignalReference  reference;
     VCDScope          * scope;
     VCDSignalSize       size;
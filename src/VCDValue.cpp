@@ -1,23 +1,144 @@
 
+#include <cstring>
+
 #include "VCDValue.hpp"
 
+#if defined(__AVX2__)
+#define VCD_DECODE_SIMD 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || \
+      (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VCD_DECODE_SIMD 1
+#include <emmintrin.h>
+#endif
+
+
+#ifdef VCD_DECODE_SIMD
+
+//! Reverse the order of the bits of a word.
+static inline uint64_t reverse_bits(uint64_t x) {
+#ifdef _MSC_VER
+    x = _byteswap_uint64(x);
+#else
+    x = __builtin_bswap64(x);
+#endif
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return x;
+}
+
+/*!
+@brief Classify 64 binary digits at once.
+@details Bit i of each mask describes @p p [i]: @p ones is set for '1',
+@p zeds for 'z' or 'Z' and @p known for '0' or '1'.
+*/
+static inline void classify_digits(
+    const char * p,
+    uint64_t   & ones,
+    uint64_t   & zeds,
+    uint64_t   & known
+){
+    ones  = 0;
+    zeds  = 0;
+    known = 0;
+
+#if defined(__AVX2__)
+    const __m256i c0   = _mm256_set1_epi8('0');
+    const __m256i c1   = _mm256_set1_epi8('1');
+    const __m256i cz   = _mm256_set1_epi8('z');
+    const __m256i lower = _mm256_set1_epi8(0x20);
+
+    for(unsigned i = 0; i < 64; i += 32) {
+        __m256i c  = _mm256_loadu_si256((const __m256i *)(p + i));
+        __m256i is0 = _mm256_cmpeq_epi8(c, c0);
+        __m256i is1 = _mm256_cmpeq_epi8(c, c1);
+        __m256i isz = _mm256_cmpeq_epi8(_mm256_or_si256(c, lower), cz);
+
+        ones  |= (uint64_t)(uint32_t)_mm256_movemask_epi8(is1) << i;
+        zeds  |= (uint64_t)(uint32_t)_mm256_movemask_epi8(isz) << i;
+        known |= (uint64_t)(uint32_t)_mm256_movemask_epi8(
+                     _mm256_or_si256(is0, is1)) << i;
+    }
+#else
+    const __m128i c0    = _mm_set1_epi8('0');
+    const __m128i c1    = _mm_set1_epi8('1');
+    const __m128i cz    = _mm_set1_epi8('z');
+    const __m128i lower = _mm_set1_epi8(0x20);
+
+    for(unsigned i = 0; i < 64; i += 16) {
+        __m128i c   = _mm_loadu_si128((const __m128i *)(p + i));
+        __m128i is0 = _mm_cmpeq_epi8(c, c0);
+        __m128i is1 = _mm_cmpeq_epi8(c, c1);
+        __m128i isz = _mm_cmpeq_epi8(_mm_or_si128(c, lower), cz);
+
+        ones  |= (uint64_t)(uint32_t)_mm_movemask_epi8(is1) << i;
+        zeds  |= (uint64_t)(uint32_t)_mm_movemask_epi8(isz) << i;
+        known |= (uint64_t)(uint32_t)_mm_movemask_epi8(
+                     _mm_or_si128(is0, is1)) << i;
+    }
+#endif
+}
+
+#endif
+
+
+/*!
+*/
+VCDValue::VCDValue    (){
+    this -> type  = VCD_SCALAR;
+    this -> width = 1;
+    this -> owns_block = false;
+    this -> value.val_bit = VCD_X;
+}
 
 /*!
 */
 VCDValue::VCDValue    (
     VCDBit  value
 ){
-    this -> type = VCD_SCALAR;
+    this -> type  = VCD_SCALAR;
+    this -> width = 1;
+    this -> owns_block = false;
     this -> value.val_bit = value;
 }
 
 /*!
 */
 VCDValue::VCDValue    (
-    VCDBitVector *  value
+    VCDSignalSize width
+){
+    this -> type  = VCD_VECTOR;
+    this -> width = width;
+    this -> owns_block = false;
+
+    if(width <= BITS_PER_WORD) {
+        this -> value.val_words[0] = 0;
+        this -> value.val_words[1] = 0;
+    } else {
+        size_t words = 2 * words_for_width(width);
+        this -> value.val_block = new uint64_t[words];
+        this -> owns_block = true;
+        std::memset(this -> value.val_block, 0, words * sizeof(uint64_t));
+    }
+}
+
+/*!
+*/
+VCDValue::VCDValue    (
+    VCDSignalSize    width,
+    const uint64_t * planes
 ){
-    this -> type = VCD_VECTOR;
-    this -> value.val_vector= value;
+    this -> type  = VCD_VECTOR;
+    this -> width = width;
+    this -> owns_block = false;
+
+    if(width <= BITS_PER_WORD) {
+        this -> value.val_words[0] = planes[0];
+        this -> value.val_words[1] = planes[1];
+    } else {
+        this -> value.val_block = const_cast<uint64_t*>(planes);
+    }
 }
 
 /*!
@@ -25,33 +146,244 @@ VCDValue::VCDValue    (
 VCDValue::VCDValue    (
     VCDReal value
 ){
-    this -> type = VCD_REAL;
+    this -> type  = VCD_REAL;
+    this -> width = 1;
+    this -> owns_block = false;
     this -> value.val_real = value;
 }
 
+/*!
+*/
+VCDValue::VCDValue (const VCDValue & other) {
+    this -> copy_from(other);
+}
+
+/*!
+*/
+VCDValue & VCDValue::operator= (const VCDValue & other) {
+    if(this != &other) {
+        this -> ~VCDValue();
+        this -> copy_from(other);
+    }
+    return *this;
+}
+
+/*!
+*/
+VCDValue::~VCDValue () {
+    if(this -> owns_block) {
+        delete [] this -> value.val_block;
+    }
+}
+
+/*!
+*/
+void VCDValue::copy_from(const VCDValue & other) {
+    this -> type  = other.type;
+    this -> width = other.width;
+    this -> owns_block = false;
+
+    if(other.type == VCD_VECTOR && other.width > BITS_PER_WORD) {
+        size_t words = 2 * words_for_width(other.width);
+        this -> value.val_block = new uint64_t[words];
+        this -> owns_block = true;
+        std::memcpy(this -> value.val_block, other.value.val_block,
+                    words * sizeof(uint64_t));
+    } else {
+        this -> value = other.value;
+    }
+}
+
 
-VCDValueType   VCDValue::get_type(){
+VCDValueType   VCDValue::get_type() const {
     return this -> type;
 }
 
 
 /*!
 */
-VCDBit       VCDValue::get_value_bit(){
+VCDBit       VCDValue::get_value_bit() const {
     return this -> value.val_bit;
 }
 
 
 /*!
 */
-VCDBitVector * VCDValue::get_value_vector(){
-    return this -> value.val_vector;
+VCDReal      VCDValue::get_value_real() const {
+    return this -> value.val_real;
 }
 
 
 /*!
 */
-VCDReal      VCDValue::get_value_real(){
-    return this -> value.val_real;
+VCDSignalSize VCDValue::get_width() const {
+    return this -> width;
+}
+
+
+/*!
+*/
+size_t       VCDValue::get_word_count() const {
+    return words_for_width(this -> width);
 }
 
+
+/*!
+*/
+uint64_t *   VCDValue::planes() {
+    if(this -> width <= BITS_PER_WORD) {
+        return this -> value.val_words;
+    }
+    return this -> value.val_block;
+}
+
+
+/*!
+*/
+const uint64_t * VCDValue::planes() const {
+    if(this -> width <= BITS_PER_WORD) {
+        return this -> value.val_words;
+    }
+    return this -> value.val_block;
+}
+
+
+/*!
+*/
+const uint64_t * VCDValue::get_value_words() const {
+    return this -> planes();
+}
+
+
+/*!
+*/
+const uint64_t * VCDValue::get_unknown_words() const {
+    return this -> planes() + this -> get_word_count();
+}
+
+
+/*!
+*/
+VCDBit       VCDValue::get_vector_bit(VCDSignalSize index) const {
+    size_t   word  = index / BITS_PER_WORD;
+    unsigned shift = index % BITS_PER_WORD;
+
+    unsigned val = (this -> get_value_words()[word]   >> shift) & 1;
+    unsigned unk = (this -> get_unknown_words()[word] >> shift) & 1;
+
+    return (VCDBit)(val | (unk << 1));
+}
+
+
+/*!
+*/
+VCDBitVector VCDValue::get_value_vector() const {
+    VCDBitVector tr;
+    tr.reserve(this -> width);
+
+    for(VCDSignalSize i = this -> width; i > 0; i --) {
+        tr.push_back(this -> get_vector_bit(i - 1));
+    }
+
+    return tr;
+}
+
+
+/*!
+*/
+void         VCDValue::load_binary(
+    const char * digits,
+    size_t       length
+){
+    decode_binary(digits, length, this -> width, this -> planes());
+}
+
+
+/*!
+@details Each word of the planes takes 64 digits. Whole words are decoded
+with SSE2 or AVX2, where the compiler targets them, by comparing 16 or 32
+digits at a time and gathering the results with movemask. The digits
+come most significant first, so the gathered masks are bit reversed. The
+remaining digits of the most significant word are decoded one at a time.
+*/
+void         VCDValue::decode_binary(
+    const char    * digits,
+    size_t          length,
+    VCDSignalSize   width,
+    uint64_t      * planes
+){
+    size_t     words = words_for_width(width);
+    uint64_t * val   = planes;
+    uint64_t * unk   = planes + words;
+
+    if(length > width) {
+        digits += length - width;
+        length  = width;
+    }
+
+    // Walk the literal from its last (least significant) digit.
+    const char * p = digits + length;
+    size_t       w = 0;
+
+#ifdef VCD_DECODE_SIMD
+    for(; w < words && (size_t)(p - digits) >= BITS_PER_WORD; w ++) {
+        uint64_t ones, zeds, known;
+
+        p -= BITS_PER_WORD;
+        classify_digits(p, ones, zeds, known);
+
+        val[w] = reverse_bits(ones | zeds);
+        unk[w] = reverse_bits(~known);
+    }
+#endif
+
+    for(; w < words; w ++) {
+        uint64_t v = 0;
+        uint64_t u = 0;
+
+        for(unsigned b = 0; b < BITS_PER_WORD && p != digits; b ++) {
+            switch(*--p) {
+                case '0':
+                    break;
+                case '1':
+                    v |= (uint64_t)1 << b;
+                    break;
+                case 'z':
+                case 'Z':
+                    v |= (uint64_t)1 << b;
+                    u |= (uint64_t)1 << b;
+                    break;
+                default:
+                    u |= (uint64_t)1 << b;
+                    break;
+            }
+        }
+
+        val[w] = v;
+        unk[w] = u;
+    }
+
+    // A literal shorter than the vector is extended with its leftmost
+    // digit when that is not 0 or 1, and with 0 otherwise.
+    if(length == 0 || length == width || digits[0] == '0' || digits[0] == '1') {
+        return;
+    }
+
+    bool extend_v = digits[0] == 'z' || digits[0] == 'Z';
+
+    for(w = length / BITS_PER_WORD; w < words; w ++) {
+        uint64_t mask = ~(uint64_t)0;
+
+        if(w == length / BITS_PER_WORD) {
+            mask <<= length % BITS_PER_WORD;
+        }
+        if(w == words - 1 && width % BITS_PER_WORD != 0) {
+            mask &= ((uint64_t)1 << (width % BITS_PER_WORD)) - 1;
+        }
+
+        unk[w] |= mask;
+        if(extend_v) {
+            val[w] |= mask;
+        }
+    }
+}
@@ -2,12 +2,22 @@
 #ifndef VCDValue_HPP
 #define VCDValue_HPP
 
+#include <cstddef>
+#include <cstdint>
+
 #include "VCDTypes.hpp"
 
 /*!
 @brief Represents a single value found in a VCD File.
 @details Can contain a single bit (a scalar), a bti vector, or an
 IEEE floating point number.
+
+Vectors are stored as two packed bit-planes of 64-bit words, least
+significant bit first: a value plane and an unknown plane. Each bit is
+encoded as value | (unknown << 1), so 0 = (0,0), 1 = (1,0), X = (0,1)
+and Z = (1,1), which matches the numeric values of VCDBit. Vectors of up
+to 64 bits are held inline, wider ones in a single contiguous block of
+2 * get_word_count() words (value plane first).
 */
 class VCDValue {
 
@@ -28,7 +38,20 @@ class VCDValue {
     }
 
     public:
-        
+
+        //! Number of bits held by each packed word.
+        static const VCDSignalSize BITS_PER_WORD = 64;
+
+        //! Number of words needed for one bit-plane of a vector.
+        static size_t words_for_width(VCDSignalSize width) {
+            return (width + BITS_PER_WORD - 1) / BITS_PER_WORD;
+        }
+
+        /*!
+        @brief Create a new VCDValue with the type VCD_SCALAR and value X
+        */
+        VCDValue    ();
+
         /*!
         @brief Create a new VCDValue with the type VCD_SCALAR
         */
@@ -38,50 +61,139 @@ class VCDValue {
 
         /*!
         @brief Create a new VCDValue with the type VCD_VECTOR
+        @details All bits of the new vector are initialised to VCD_0.
+        @param width in - The number of bits in the vector.
         */
         VCDValue    (
-            VCDBitVector * value
+            VCDSignalSize width
         );
 
         /*!
-        @brief Create a new VCDValue with the type VCD_VECTOR
+        @brief Create a new VCDValue with the type VCD_VECTOR from packed
+        bit-planes.
+        @details Vectors of up to 64 bits copy their planes. Wider vectors
+        refer to @p planes in place, which must outlive the value and must
+        not be modified through it; copies of the value own their planes.
+        @param width in - The number of bits in the vector.
+        @param planes in - 2 * words_for_width(width) words, the value
+        plane followed by the unknown plane.
+        */
+        VCDValue    (
+            VCDSignalSize    width,
+            const uint64_t * planes
+        );
+
+        /*!
+        @brief Create a new VCDValue with the type VCD_REAL
         */
         VCDValue    (
             VCDReal value
         );
 
+        //! Copy a value, duplicating the bit-planes of wide vectors.
+        VCDValue (const VCDValue & other);
+
+        //! Assign a value, duplicating the bit-planes of wide vectors.
+        VCDValue & operator= (const VCDValue & other);
+
+        ~VCDValue ();
 
-        ~VCDValue () {
-            if(this -> type == VCD_VECTOR) {
-                delete this -> value.val_vector;
-            }
-        }
-        
 
         //! Return the type of value stored by this class instance.
-        VCDValueType   get_type();
-        
+        VCDValueType   get_type() const;
+
         //! Get the bit value of the instance.
-        VCDBit       get_value_bit();
-        
-        //! Get the vector value of the instance.
-        VCDBitVector * get_value_vector();
+        VCDBit       get_value_bit() const;
 
         //! Get the real value of the instance.
-        VCDReal      get_value_real();
+        VCDReal      get_value_real() const;
+
+        //! Get the width in bits of a vector value.
+        VCDSignalSize get_width() const;
+
+        //! Get the number of words in each bit-plane of a vector value.
+        size_t       get_word_count() const;
+
+        //! Get the value bit-plane of a vector, least significant word first.
+        const uint64_t * get_value_words() const;
+
+        //! Get the unknown bit-plane of a vector, least significant word first.
+        const uint64_t * get_unknown_words() const;
+
+        //! Get bit @p index (0 is the least significant bit) of a vector.
+        VCDBit       get_vector_bit(VCDSignalSize index) const;
+
+        /*!
+        @brief Unpack a vector value into one VCDBit per element.
+        @details The result is ordered most significant bit first, the
+        same order the bits appear in the trace. Prefer the word accessors
+        where possible, this allocates.
+        */
+        VCDBitVector get_value_vector() const;
+
+        /*!
+        @brief Load the bits of a vector from a VCD binary literal.
+        @details @p digits holds the characters following the 'b' of the
+        literal, most significant bit first. Any character other than
+        0, 1, z or Z decodes as X. A literal shorter than get_width() is
+        extended as decode_binary() describes, and digits beyond
+        get_width() are dropped from the left.
+        @param digits in - The binary digits.
+        @param length in - The number of digits.
+        */
+        void         load_binary(
+            const char * digits,
+            size_t       length
+        );
+
+        /*!
+        @brief Decode a VCD binary literal into packed bit-planes.
+        @details When @p length exceeds @p width only the least
+        significant @p width digits are kept. A shorter literal is left
+        extended to @p width as the VCD format specifies: with Z if its
+        leftmost digit is z or Z, with 0 if that is 0 or 1, and with X
+        otherwise.
+        @param digits in - The binary digits, most significant first.
+        @param length in - The number of digits.
+        @param width in - The number of bits to produce.
+        @param planes out - 2 * words_for_width(width) words, the value
+        plane followed by the unknown plane.
+        */
+        static void  decode_binary(
+            const char    * digits,
+            size_t          length,
+            VCDSignalSize   width,
+            uint64_t      * planes
+        );
 
 
     protected:
 
         //! The type of value this instance stores.
         VCDValueType    type;
-        
+
+        //! Width in bits of a vector value, 1 for scalars and reals.
+        VCDSignalSize   width;
+
+        //! Whether val_block was allocated by, and is freed by, this value.
+        bool            owns_block;
+
         //! The actual value stored, as identified by type.
         union valstore {
             VCDBit         val_bit;   //!< Value as a bit
-            VCDBitVector * val_vector;//!< Value as a bit vector
             VCDReal        val_real;  //!< Value as a real number (double).
+            uint64_t       val_words[2]; //!< Value and unknown planes, width <= 64
+            uint64_t     * val_block; //!< Both planes of a wider vector
         } value;
+
+        //! Mutable access to the value plane, the unknown plane follows it.
+        uint64_t * planes();
+
+        //! Read-only access to the value plane, the unknown plane follows it.
+        const uint64_t * planes() const;
+
+        //! Copy the contents of another value into this (empty) instance.
+        void copy_from(const VCDValue & other);
 };
 
 
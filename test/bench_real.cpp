@@ -0,0 +1,224 @@
+/*!
+@file bench_real.cpp
+@brief Benchmark of parsing real value changes.
+
+Checks VCDFileParser::parse_real() against strtod() on numbers written
+the ways simulators write them, times it against the sscanf() it
+replaced, and times parsing a real heavy trace such as a mixed-signal
+simulation dumps.
+*/
+
+#include "VCDFileParser.hpp"
+#include <chrono>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock bench_clock;
+
+//! Seconds since @p start.
+static double seconds_since(bench_clock::time_point start) {
+    return std::chrono::duration<double>(bench_clock::now() - start).count();
+}
+
+/*!
+ * @brief Numbers in the formats found in real value changes
+ * @param count Number of numbers to generate
+ */
+std::vector<std::string> generate_numbers(size_t count) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> volts(-5.0, 5.0);
+    std::uniform_int_distribution<int> scale(-300, 300);
+
+    static const char * formats[] = {"%.16g", "%.17g", "%.6f", "%e", "%g"};
+
+    std::vector<std::string> numbers;
+    char text[64];
+
+    for (size_t i = 0; i < count; ++i) {
+        double value = volts(rng);
+        switch (i % 8) {
+            case 5:  value = std::ldexp(value, scale(rng) * 3); break;
+            case 6:  value = std::floor(value * 1000); break;
+            case 7:  value = value * 1e-12; break;
+            default: break;
+        }
+        std::snprintf(text, sizeof(text), formats[i % 5], value);
+        numbers.push_back(text);
+    }
+
+    numbers.push_back("inf");
+    numbers.push_back("-inf");
+    numbers.push_back("nan");
+    numbers.push_back("0");
+    numbers.push_back("-0.0");
+    numbers.push_back(".5");
+    numbers.push_back("5.");
+    numbers.push_back("+1E+3");
+    numbers.push_back("123456789012345678901234567890");
+    numbers.push_back("0.000000000000000000000000000000001");
+    numbers.push_back("4.9406564584124654e-324");
+    numbers.push_back("1.7976931348623157e308");
+    numbers.push_back("9007199254740993");
+
+    return numbers;
+}
+
+/*!
+ * @brief Check parse_real against values from strtod, bit for bit
+ * @returns The number of mismatches
+ */
+size_t check_exact(const std::vector<std::string> & numbers,
+                   const std::vector<double> & expected) {
+    size_t mismatches = 0;
+
+    for (size_t i = 0; i < numbers.size(); ++i) {
+        const std::string & number = numbers[i];
+        double expect = expected[i];
+        double got    = VCDFileParser::parse_real(number.data(), number.size());
+
+        bool same = std::memcmp(&expect, &got, sizeof(double)) == 0 ||
+                    (std::isnan(expect) && std::isnan(got));
+        if (!same) {
+            if (mismatches < 10) {
+                std::printf("  MISMATCH %s: %.17g != %.17g\n",
+                            number.c_str(), got, expect);
+            }
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+/*!
+ * @brief Time converting every number with parse_real and with sscanf
+ */
+void bench_conversion(const std::vector<std::string> & numbers, int rounds) {
+    double sum = 0;
+
+    bench_clock::time_point start = bench_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (const std::string & number : numbers) {
+            sum += VCDFileParser::parse_real(number.data(), number.size());
+        }
+    }
+    double fast = seconds_since(start);
+
+    start = bench_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (const std::string & number : numbers) {
+            float tmp = 0;
+            std::sscanf(number.c_str(), "%g", &tmp);
+            sum += tmp;
+        }
+    }
+    double slow = seconds_since(start);
+
+    double count = (double)numbers.size() * rounds;
+    std::printf("parse_real: %8.1f ns/number\n", fast * 1e9 / count);
+    std::printf("sscanf %%g:  %8.1f ns/number\n", slow * 1e9 / count);
+    // Printed so that the conversions are not optimised away.
+    std::printf("(checksum %g)\n", sum);
+}
+
+/*!
+ * @brief Write a trace of analog nets sampled every time step
+ * @param filename Output filename
+ * @param num_reals Number of real signals
+ * @param num_bits Number of digital signals
+ * @param num_timestamps Number of time steps
+ */
+void generate_mixed_signal_vcd(const std::string & filename, int num_reals,
+                               int num_bits, int num_timestamps) {
+    std::ofstream out(filename);
+    std::mt19937_64 rng(7);
+    std::normal_distribution<double> noise(0.0, 0.01);
+
+    out << "$timescale 1ps $end\n";
+    out << "$scope module tb $end\n";
+    for (int i = 0; i < num_reals; ++i) {
+        out << "$var real 64 r" << i << " v" << i << " [63:0] $end\n";
+    }
+    for (int i = 0; i < num_bits; ++i) {
+        out << "$var wire 1 d" << i << " clk" << i << " $end\n";
+    }
+    out << "$upscope $end\n";
+    out << "$enddefinitions $end\n";
+
+    char text[64];
+    for (int t = 0; t < num_timestamps; ++t) {
+        out << "#" << t * 10 << "\n";
+        for (int i = 0; i < num_reals; ++i) {
+            double v = 1.65 * std::sin(t * 0.01 + i) + noise(rng);
+            std::snprintf(text, sizeof(text), "r%.16g r%d\n", v, i);
+            out << text;
+        }
+        for (int i = 0; i < num_bits; ++i) {
+            out << ((t >> i) & 1) << "d" << i << "\n";
+        }
+    }
+}
+
+/*!
+ * @brief Time parsing a real heavy trace
+ */
+void bench_trace(const std::string & filename) {
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    double megabytes = (double)in.tellg() / (1 << 20);
+
+    VCDFileParser parser;
+
+    bench_clock::time_point start = bench_clock::now();
+    VCDFile * trace = parser.parse_file(filename);
+    double elapsed = seconds_since(start);
+
+    if (!trace) {
+        std::cout << "  FAILED to parse " << filename << "\n";
+        std::exit(1);
+    }
+
+    std::printf("trace:      %8.1f MB/s (%.1f MB in %.3f s)\n",
+                megabytes / elapsed, megabytes, elapsed);
+
+    delete trace;
+}
+
+int main(int argc, char** argv) {
+    std::cout << "======================================\n";
+    std::cout << "VCD Parser Real Value Benchmark\n";
+    std::cout << "======================================\n";
+
+    std::vector<std::string> numbers = generate_numbers(200000);
+
+    std::vector<double> expected;
+    for (const std::string & number : numbers) {
+        expected.push_back(std::strtod(number.c_str(), nullptr));
+    }
+
+    size_t mismatches = check_exact(numbers, expected);
+
+    // A decimal comma must not change the result.
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8")) {
+        mismatches += check_exact(numbers, expected);
+        std::setlocale(LC_NUMERIC, "C");
+    }
+
+    std::cout << "Exactness: " << mismatches << " mismatches\n";
+
+    bench_conversion(numbers, 5);
+
+    std::string filename = "bench_real.vcd";
+    generate_mixed_signal_vcd(filename, 64, 8, argc > 1 ? std::atoi(argv[1]) : 20000);
+    bench_trace(filename);
+    std::remove(filename.c_str());
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,1859 @@
+/*!
+@file test_modes.cpp
+@brief Behaviour tests for the parse modes and options of the parser
+
+Generates VCD files and checks that each way of reading them gives the
+same histories, timestamps and events as a plain parse_file().
+*/
+
+#include "VCDFileParser.hpp"
+#include "VCDEventReader.hpp"
+#include "VCDFileCache.hpp"
+#include "VCDFileIndex.hpp"
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdint>
+#include <cstdio>
+#include <cassert>
+#include <limits>
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef VCD_NO_ZLIB
+#include <zlib.h>
+#endif
+
+/*!
+ * @brief Small deterministic generator, so every run writes the same files
+ */
+class TestRandom {
+    public:
+        explicit TestRandom(uint32_t seed) : state(seed ? seed : 1) {}
+
+        uint32_t next() {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        uint32_t below(uint32_t n) {
+            return next() % n;
+        }
+
+    private:
+        uint32_t state;
+};
+
+//! Identifier codes of the signals written by generate_mixed_vcd().
+static const char* CODE_CLK  = "!";
+static const char* CODE_PC   = "\"";
+static const char* CODE_FLAG = "#";
+static const char* CODE_ACC  = "%";
+static const char* CODE_DATA = "&";
+static const char* CODE_WE   = "'";
+static const char* CODE_ADDR = "((";
+
+static std::string random_bits(TestRandom& rng, int width, bool unknowns) {
+    static const char digits[] = {'0', '1', 'x', 'z'};
+    std::string bits;
+    for (int i = 0; i < width; ++i) {
+        bits += digits[rng.below(unknowns && rng.below(8) == 0 ? 4 : 2)];
+    }
+    return bits;
+}
+
+static std::string random_real(TestRandom& rng) {
+    static const char* reals[] = {
+        "1.5", "-2.25e-3", "123456789.123456789", "1e10", "0", "-0.1",
+        "3.14159265358979323846", "6.02214076e23", "+7", ".5", "2.5E+2"
+    };
+    return reals[rng.below(sizeof(reals) / sizeof(reals[0]))];
+}
+
+/*!
+ * @brief Generate a VCD file holding every kind of value change
+ * @param filename Output filename
+ * @param num_timestamps Number of #time markers after #0
+ * @param dumpall_every Write a $dumpall block every this many markers, 0 for none
+ * @param seed Seed of the values
+ * @returns The times of the markers, in file order
+ *
+ * The signals are scalars, a 32 bit and a 96 bit vector, a real and a
+ * two character identifier code, over nested scopes. Two signals share
+ * an identifier code. Vector values are sometimes written shorter than
+ * the width or with x and z digits, scalars are sometimes written to a
+ * vector, and reals are sometimes written to a vector, which drops them.
+ * Markers are 1, 9 or 10 apart.
+ */
+std::vector<VCDTime> generate_mixed_vcd(const std::string& filename, int num_timestamps,
+                                        int dumpall_every, uint32_t seed = 1) {
+    std::ofstream out(filename, std::ios::binary);
+    TestRandom rng(seed);
+    std::vector<VCDTime> times;
+
+    out << "$date\n   Test VCD file for parse modes\n$end\n";
+    out << "$version\n   VCD Generator 1.0\n$end\n";
+    out << "$timescale 1ns $end\n";
+    out << "$scope module top $end\n";
+    out << "$var wire 1 " << CODE_CLK << " clk $end\n";
+    out << "$scope module cpu $end\n";
+    out << "$var reg 32 " << CODE_PC << " pc [31:0] $end\n";
+    out << "$var wire 1 " << CODE_FLAG << " flag $end\n";
+    out << "$var real 1 " << CODE_ACC << " acc $end\n";
+    out << "$upscope $end\n";
+    out << "$scope module mem $end\n";
+    out << "$var reg 96 " << CODE_DATA << " data [95:0] $end\n";
+    out << "$var wire 1 " << CODE_WE << " we $end\n";
+    out << "$var reg 8 " << CODE_ADDR << " addr [7:0] $end\n";
+    out << "$var wire 1 " << CODE_FLAG << " flag_alias $end\n";
+    out << "$upscope $end\n";
+    out << "$upscope $end\n";
+    out << "$enddefinitions $end\n";
+
+    // Current value of each signal, for $dumpall blocks.
+    std::string clk = "0", pc = random_bits(rng, 32, false), flag = "x";
+    std::string acc = "0", data = random_bits(rng, 96, true), we = "0";
+    std::string addr = random_bits(rng, 8, false);
+
+    auto dump = [&](const char* keyword) {
+        out << keyword << "\n";
+        out << clk << CODE_CLK << "\n";
+        out << "b" << pc << " " << CODE_PC << "\n";
+        out << flag << CODE_FLAG << "\n";
+        out << "r" << acc << " " << CODE_ACC << "\n";
+        out << "b" << data << " " << CODE_DATA << "\n";
+        out << we << CODE_WE << "\n";
+        out << "b" << addr << " " << CODE_ADDR << "\n";
+        out << "$end\n";
+    };
+
+    VCDTime time = 0;
+    out << "#0\n";
+    times.push_back(0);
+    dump("$dumpvars");
+
+    static const VCDTime steps[] = {1, 9, 10};
+
+    for (int t = 1; t <= num_timestamps; ++t) {
+        time += steps[rng.below(3)];
+        out << "#" << time << "\n";
+        times.push_back(time);
+
+        if (dumpall_every && t % dumpall_every == 0) {
+            dump("$dumpall");
+            continue;
+        }
+
+        clk = clk == "0" ? "1" : "0";
+        out << clk << CODE_CLK << "\n";
+
+        switch (rng.below(4)) {
+            case 0:
+                pc = random_bits(rng, 32, true);
+                out << "b" << pc << " " << CODE_PC << "\n";
+                break;
+            case 1:
+                // Leading zeros left out, extended back to the width.
+                pc = std::string(28, '0') + "1" + random_bits(rng, 3, false);
+                out << "b" << pc.substr(28) << " " << CODE_PC << "\n";
+                break;
+            case 2:
+                // A real on a vector is dropped.
+                out << "r" << random_real(rng) << " " << CODE_PC << "\n";
+                break;
+            default:
+                break;
+        }
+
+        if (rng.below(3) == 0) {
+            static const char* bits[] = {"0", "1", "x", "z"};
+            flag = bits[rng.below(4)];
+            out << flag << CODE_FLAG << "\n";
+        }
+        if (rng.below(3) == 0) {
+            acc = random_real(rng);
+            out << "r" << acc << " " << CODE_ACC << "\n";
+        }
+        if (rng.below(4) == 0) {
+            data = random_bits(rng, 96, true);
+            out << "b" << data << " " << CODE_DATA << "\n";
+        }
+        if (rng.below(2) == 0) {
+            we = we == "0" ? "1" : "0";
+            out << we << CODE_WE << "\n";
+        }
+        if (rng.below(5) == 0) {
+            // A scalar on a vector is a one digit literal.
+            addr = std::string(7, '0') + "1";
+            out << "1" << CODE_ADDR << "\n";
+        } else if (rng.below(3) == 0) {
+            addr = random_bits(rng, 8, false);
+            out << "b" << addr << " " << CODE_ADDR << "\n";
+        }
+    }
+
+    out.close();
+    return times;
+}
+
+/*!
+ * @brief Whether two values have the same type and contents
+ */
+bool same_value(const VCDValue& a, const VCDValue& b) {
+    if (a.get_type() != b.get_type()) {
+        return false;
+    }
+    switch (a.get_type()) {
+        case VCD_SCALAR:
+            return a.get_value_bit() == b.get_value_bit();
+        case VCD_REAL:
+            return a.get_value_real() == b.get_value_real();
+        default:
+            if (a.get_width() != b.get_width()) {
+                return false;
+            }
+            for (size_t w = 0; w < a.get_word_count(); ++w) {
+                if (a.get_value_words()[w] != b.get_value_words()[w] ||
+                    a.get_unknown_words()[w] != b.get_unknown_words()[w]) {
+                    return false;
+                }
+            }
+            return true;
+    }
+}
+
+/*!
+ * @brief A time marker or value change, as passed to a handler or read
+ */
+struct RecordedEvent {
+    VCDEventType type;
+    VCDTime time;
+    VCDSignalId id;
+    VCDValue value;
+};
+
+/*!
+ * @brief Records every event passed by VCDFileParser::parse_events()
+ */
+class EventRecorder : public VCDEventHandler {
+    public:
+        std::vector<RecordedEvent> events;
+        int scopes = 0;
+        int upscopes = 0;
+        int vars = 0;
+        int enddefinitions = 0;
+
+        void on_scope(const VCDScope&) override {
+            scopes++;
+        }
+
+        void on_upscope(const VCDScope&) override {
+            upscopes++;
+        }
+
+        void on_var(const VCDSignal&) override {
+            vars++;
+        }
+
+        void on_enddefinitions(const VCDFile&) override {
+            enddefinitions++;
+        }
+
+        void on_time(VCDTime time) override {
+            events.push_back(RecordedEvent{VCD_EVENT_TIME, time, VCD_SIGNAL_ID_NONE, VCDValue()});
+        }
+
+        void on_scalar(VCDTime time, VCDSignalId id, VCDBit value) override {
+            events.push_back(RecordedEvent{VCD_EVENT_SCALAR, time, id, VCDValue(value)});
+        }
+
+        // Copied, as wide values refer to a buffer of the parser.
+        void on_vector(VCDTime time, VCDSignalId id, const VCDValue& value) override {
+            events.push_back(RecordedEvent{VCD_EVENT_VECTOR, time, id, value});
+        }
+
+        void on_real(VCDTime time, VCDSignalId id, VCDReal value) override {
+            events.push_back(RecordedEvent{VCD_EVENT_REAL, time, id, VCDValue(value)});
+        }
+};
+
+/*!
+ * @brief Read every event of a file with an open VCDEventReader
+ */
+std::vector<RecordedEvent> read_events(VCDEventReader& reader) {
+    std::vector<RecordedEvent> events;
+    VCDEvent event;
+    while (reader.next(event)) {
+        VCDValue value;
+        if (event.type != VCD_EVENT_TIME) {
+            value = event.get_value();
+        }
+        events.push_back(RecordedEvent{event.type, event.time,
+                                       event.type == VCD_EVENT_TIME ? VCD_SIGNAL_ID_NONE : event.id,
+                                       value});
+    }
+    return events;
+}
+
+/*!
+ * @brief Number of positions at which two event sequences differ
+ */
+int count_event_mismatches(const std::vector<RecordedEvent>& a,
+                           const std::vector<RecordedEvent>& b) {
+    int mismatches = a.size() == b.size() ? 0 : 1;
+    for (size_t i = 0; i < a.size() && i < b.size(); ++i) {
+        if (a[i].type != b[i].type || a[i].time != b[i].time || a[i].id != b[i].id ||
+            (a[i].type != VCD_EVENT_TIME && !same_value(a[i].value, b[i].value))) {
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+/*!
+ * @brief Read a window of a file with VCDEventReader and parse_events()
+ */
+void test_reader_start_time() {
+    std::cout << "\n=== Test 1: Event Reader Skips To start_time ===\n";
+
+    std::string filename = "modes_reader.vcd";
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 200, 0);
+
+    // Before, on and between markers, and past the last one.
+    std::vector<VCDTime> starts = {1, times[1], times[1] + 1, times[100],
+                                   times[100] + 1, times.back(), times.back() + 1};
+    int mismatches = 0;
+    int checked = 0;
+
+    for (bool mapped : {true, false}) {
+        for (VCDTime start : starts) {
+            for (VCDTime end : {times.back(), times[150]}) {
+                EventRecorder recorder;
+                VCDFileParser parser;
+                parser.use_mmap = mapped;
+                parser.start_time = start;
+                parser.end_time = end;
+                bool parsed = parser.parse_events(filename, recorder);
+                assert(parsed);
+
+                VCDEventReader reader;
+                reader.parser.use_mmap = mapped;
+                reader.parser.start_time = start;
+                reader.parser.end_time = end;
+                bool opened = reader.open(filename);
+                assert(opened);
+                std::vector<RecordedEvent> events = read_events(reader);
+                assert(!reader.failed());
+
+                mismatches += count_event_mismatches(recorder.events, events);
+
+                // Every signal has its value from start_time on.
+                if (start <= end && start <= times.back()) {
+                    assert(!events.empty() && events[0].type == VCD_EVENT_TIME &&
+                           events[0].time == start);
+                    size_t values = 0;
+                    while (values + 1 < events.size() && events[values + 1].time == start &&
+                           events[values + 1].type != VCD_EVENT_TIME) {
+                        values++;
+                    }
+                    if (values < reader.get_header()->get_signal_id_count()) {
+                        mismatches++;
+                    }
+                }
+                checked++;
+            }
+        }
+    }
+
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << checked << " windows, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Value of a signal at a time, or false if it had none
+ */
+bool value_at(VCDFile* trace, const std::string& code, VCDTime time, VCDValue& value) {
+    return trace->get_signal_value_at(trace->get_signal_id(code), time, value);
+}
+
+/*!
+ * @brief Parse the value change section with its odd corners
+ */
+void test_body_scanner() {
+    std::cout << "\n=== Test 2: Value Change Section Syntax ===\n";
+
+    std::string filename = "modes_body.vcd";
+    std::ofstream out(filename, std::ios::binary);
+    out << "$timescale 1ns $end\n";
+    out << "$scope module top $end\n";
+    out << "$var wire 1 ! a $end\n";
+    out << "$var wire 4 \" v [3:0] $end\n";
+    out << "$var real 1 #x r $end\n";
+    out << "$var wire 1 a~ b $end\n";
+    out << "$upscope $end\n";
+    out << "$enddefinitions $end\n";
+    // Comments, CRLF line ends, tabs, upper case and several changes per line.
+    out << "$comment no #99 or 0! in here $end\r\n";
+    out << "#0\r\n$dumpvars\r\n1!\r\nb10 \"\r\nR-1.25e2 #x\r\nZa~\r\n$end\r\n";
+    out << "#5\r\n\tX!\t\r\nB1x0z \"\r\n";
+    out << "#12 0! r3.5 #x\n";
+    out.close();
+
+    VCDFileParser parser;
+    VCDFile* trace = parser.parse_file(filename);
+    std::remove(filename.c_str());
+    assert(trace != nullptr);
+
+    std::vector<VCDTime> expected_times = {0, 5, 12};
+    assert(*trace->get_timestamps() == expected_times);
+
+    VCDValue value;
+    assert(value_at(trace, "!", 0, value) && value.get_value_bit() == VCD_1);
+    assert(value_at(trace, "!", 7, value) && value.get_value_bit() == VCD_X);
+    assert(value_at(trace, "!", 12, value) && value.get_value_bit() == VCD_0);
+    assert(trace->get_signal_values(trace->get_signal_id("!"))->size() == 3);
+
+    // Short literals are extended with zeros, x is (0,1) and z is (1,1).
+    assert(value_at(trace, "\"", 0, value) && value.get_value_words()[0] == 2 &&
+           value.get_unknown_words()[0] == 0);
+    assert(value_at(trace, "\"", 5, value) && value.get_value_words()[0] == 9 &&
+           value.get_unknown_words()[0] == 5);
+
+    assert(value_at(trace, "#x", 0, value) && value.get_value_real() == -125.0);
+    assert(value_at(trace, "#x", 12, value) && value.get_value_real() == 3.5);
+    assert(value_at(trace, "a~", 12, value) && value.get_value_bit() == VCD_Z);
+
+    delete trace;
+
+    // Digits and numbers the lexer rejects are errors, read either way.
+    std::string header = "$scope module top $end\n"
+                         "$var wire 4 \" v [3:0] $end\n"
+                         "$var real 1 #x r $end\n"
+                         "$upscope $end\n"
+                         "$enddefinitions $end\n#0\n";
+    int mismatches = 0;
+    struct { const char* change; bool valid; } changes[] = {
+        {"b10q0 \"", false}, {"b \"", false}, {"b1-1 \"", false},
+        {"r1.2.3 #x", false}, {"r1e #x", false}, {"r. #x", false},
+        {"rinfinity #x", false}, {"r0x10 #x", false}, {"r+-1 #x", false},
+        {"r+.5 #x", true}, {"r1. #x", true}, {"rNaN #x", true},
+        {"r-Inf #x", true}, {"r1E+3 #x", true}, {"bXz10 \"", true},
+    };
+    for (const auto& c : changes) {
+        std::ofstream bad(filename, std::ios::binary);
+        bad << header << c.change << "\n#1\n";
+        bad.close();
+        for (bool mapped : {true, false}) {
+            VCDFileParser checker;
+            checker.use_mmap = mapped;
+            VCDFile* parsed = checker.parse_file(filename);
+            if ((parsed != nullptr) != c.valid) {
+                mismatches++;
+            }
+            delete parsed;
+        }
+    }
+
+    // Errors give their line, in memory and across the blocks of a stream.
+    std::string body = "#0\n1!\n\n$comment two\nlines $end\nb0 !\n\n#5 b12 !\n";
+    VCDBodyScanner scanner;
+    VCDBodyToken token;
+    std::string message;
+    scanner.reset(body.data(), body.size());
+    while (scanner.next(token)) {
+        if (token.type == VCD_BODY_ERROR) {
+            message = scanner.syntax_error(token);
+        }
+    }
+    if (message != "syntax error, unexpected \"b12\" on line 8") {
+        mismatches++;
+    }
+
+    std::ofstream stream_out(filename, std::ios::binary);
+    stream_out << body;
+    stream_out.close();
+    VCDInput input;
+    bool opened = input.open(filename, false, 3, 2);
+    assert(opened);
+    message.clear();
+    scanner.reset(&input, nullptr, 0, 4);
+    scanner.set_line(scanner.get_position(), 20);
+    while (scanner.next(token)) {
+        if (token.type == VCD_BODY_ERROR) {
+            message = scanner.syntax_error(token);
+        }
+    }
+    if (message != "syntax error, unexpected \"b12\" on line 27") {
+        mismatches++;
+    }
+    input.close();
+    std::remove(filename.c_str());
+
+    std::cout << "Results: every value as written, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Number of changes at which two histories differ
+ */
+int count_history_mismatches(const VCDSignalValues* a, const VCDSignalValues* b) {
+    if (a->size() != b->size() || a->get_type() != b->get_type()) {
+        return 1;
+    }
+    int mismatches = 0;
+    for (size_t i = 0; i < a->size(); ++i) {
+        if (a->get_time(i) != b->get_time(i) || !same_value(a->get_value(i), b->get_value(i))) {
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+/*!
+ * @brief Number of differences between the timestamps and histories of two files
+ */
+int count_file_mismatches(VCDFile* a, VCDFile* b) {
+    int mismatches = *a->get_timestamps() == *b->get_timestamps() ? 0 : 1;
+    if (a->get_signal_id_count() != b->get_signal_id_count()) {
+        return mismatches + 1;
+    }
+    for (size_t id = 0; id < a->get_signal_id_count(); ++id) {
+        mismatches += count_history_mismatches(a->get_signal_values((VCDSignalId)id),
+                                               b->get_signal_values((VCDSignalId)id));
+    }
+    return mismatches;
+}
+
+/*!
+ * @brief Parse a file with a fresh parser set up by @p setup
+ */
+template<typename Setup>
+VCDFile* parse_with(const std::string& filename, Setup setup) {
+    VCDFileParser parser;
+    setup(parser);
+    return parser.parse_file(filename);
+}
+
+/*!
+ * @brief Parse the value changes of a large file with several threads
+ */
+void test_parallel_parse() {
+    std::cout << "\n=== Test 3: Parallel Parse Of One File ===\n";
+
+    std::string filename = "modes_parallel.vcd";
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 60000, 0);
+
+    VCDFile* plain = parse_with(filename, [](VCDFileParser&) {});
+    assert(plain != nullptr);
+
+    int mismatches = 0;
+
+    for (unsigned threads : {2u, 4u, 7u}) {
+        VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) { p.threads = threads; });
+        assert(trace != nullptr);
+        mismatches += count_file_mismatches(plain, trace);
+        delete trace;
+    }
+
+    // Stopping at end_time part way through a chunk.
+    VCDTime end = times[times.size() / 3];
+    VCDFile* serial = parse_with(filename, [&](VCDFileParser& p) { p.end_time = end; });
+    VCDFile* parallel = parse_with(filename, [&](VCDFileParser& p) {
+        p.end_time = end;
+        p.threads = 4;
+    });
+    assert(serial != nullptr && parallel != nullptr);
+    mismatches += count_file_mismatches(serial, parallel);
+    assert(serial->get_timestamps()->back() == end);
+
+    delete serial;
+    delete parallel;
+    delete plain;
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Keep only the signals selected by path and pattern
+ */
+void test_selection() {
+    std::cout << "\n=== Test 4: Signal Selection ===\n";
+
+    std::string filename = "modes_select.vcd";
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 500, 0);
+
+    VCDFile* plain = parse_with(filename, [](VCDFileParser&) {});
+    assert(plain != nullptr);
+
+    struct Case {
+        std::vector<std::string> paths;
+        std::vector<std::string> patterns;
+        std::vector<std::string> kept;
+        VCDTime start;
+    };
+    // top.cpu.flag and top.mem.flag_alias share a code, so selecting one keeps both.
+    std::vector<Case> cases = {
+        {{"top.cpu"}, {".*\\.we"}, {CODE_PC, CODE_FLAG, CODE_ACC, CODE_WE}, 0},
+        {{"top.mem.addr"}, {}, {CODE_ADDR}, 0},
+        {{}, {"top\\.mem\\..*_alias", "top\\.c.k"}, {CODE_FLAG, CODE_CLK}, 0},
+        {{"top.mem"}, {}, {CODE_DATA, CODE_WE, CODE_ADDR, CODE_FLAG}, times[250]},
+    };
+
+    int mismatches = 0;
+
+    for (const Case& c : cases) {
+        VCDFileParser parser;
+        for (const std::string& path : c.paths) {
+            parser.select(path);
+        }
+        for (const std::string& pattern : c.patterns) {
+            parser.select_pattern(pattern);
+        }
+        parser.start_time = c.start;
+
+        VCDFile* trace = parser.parse_file(filename);
+        assert(trace != nullptr);
+
+        for (size_t id = 0; id < trace->get_signal_id_count(); ++id) {
+            bool kept = false;
+            for (const std::string& code : c.kept) {
+                kept = kept || trace->get_signal_id(code) == (VCDSignalId)id;
+            }
+            const VCDSignalValues* values = trace->get_signal_values((VCDSignalId)id);
+            if (parser.is_selected((VCDSignalId)id) != kept || (!kept && !values->empty())) {
+                mismatches++;
+            }
+            // Kept signals have the value of a plain parse at every time.
+            for (size_t t = 0; kept && t < times.size(); t += 7) {
+                if (times[t] < c.start) {
+                    continue;
+                }
+                VCDValue a, b;
+                bool has_a = plain->get_signal_value_at((VCDSignalId)id, times[t], a);
+                bool has_b = trace->get_signal_value_at((VCDSignalId)id, times[t], b);
+                if (has_a != has_b || (has_a && !same_value(a, b))) {
+                    mismatches++;
+                }
+            }
+        }
+
+        delete trace;
+    }
+
+    // Everything is kept again once the selection is cleared.
+    VCDFileParser parser;
+    parser.select("top.cpu.pc");
+    parser.clear_selection();
+    VCDFile* trace = parser.parse_file(filename);
+    assert(trace != nullptr);
+    mismatches += count_file_mismatches(plain, trace);
+    delete trace;
+
+    bool thrown = false;
+    try {
+        parser.select_pattern("top.(cpu");
+    } catch (const std::regex_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    delete plain;
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Number of differences between recorded events and a parsed file
+ * @details The time events must be the timestamps of the file. The value
+ * events of each signal are appended to a history of the same type and
+ * width, which converts or drops them as parsing does, and must then
+ * match the history of the file.
+ */
+int count_event_file_mismatches(const std::vector<RecordedEvent>& events, VCDFile* trace) {
+    std::vector<VCDTime> times;
+    std::vector<VCDSignalValues> histories;
+    int mismatches = 0;
+
+    for (size_t id = 0; id < trace->get_signal_id_count(); ++id) {
+        const VCDSignalValues* values = trace->get_signal_values((VCDSignalId)id);
+        histories.push_back(VCDSignalValues(values->get_type(), values->get_width()));
+    }
+
+    for (const RecordedEvent& event : events) {
+        VCDSignalValues* history = event.type == VCD_EVENT_TIME ? nullptr : &histories[event.id];
+        std::string digits;
+
+        switch (event.type) {
+            case VCD_EVENT_TIME:
+                times.push_back(event.time);
+                break;
+            case VCD_EVENT_SCALAR:
+                history->append_scalar(event.time, event.value.get_value_bit());
+                break;
+            case VCD_EVENT_REAL:
+                history->append_real(event.time, event.value.get_value_real());
+                break;
+            case VCD_EVENT_VECTOR:
+                for (VCDSignalSize i = event.value.get_width(); i > 0; --i) {
+                    digits += "01xz"[event.value.get_vector_bit(i - 1) & 3];
+                }
+                history->append_vector(event.time, digits.data(), digits.size());
+                break;
+        }
+    }
+
+    for (size_t id = 0; id < histories.size(); ++id) {
+        mismatches += count_history_mismatches(&histories[id],
+                                               trace->get_signal_values((VCDSignalId)id));
+    }
+    if (times != *trace->get_timestamps()) {
+        mismatches++;
+    }
+    return mismatches;
+}
+
+/*!
+ * @brief Stream a file through an event handler
+ */
+void test_event_handler() {
+    std::cout << "\n=== Test 5: Event Handler Matches parse_file ===\n";
+
+    std::string filename = "modes_handler.vcd";
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 1000, 0);
+
+    int mismatches = 0;
+
+    for (VCDTime start : {std::numeric_limits<VCDTime>::min(), times[400], times[400] + 1}) {
+        for (VCDTime end : {std::numeric_limits<VCDTime>::max(), times[700]}) {
+            auto window = [&](VCDFileParser& p) {
+                p.start_time = start;
+                p.end_time = end;
+            };
+
+            VCDFile* trace = parse_with(filename, window);
+            assert(trace != nullptr);
+
+            EventRecorder recorder;
+            VCDFileParser parser;
+            window(parser);
+            bool parsed = parser.parse_events(filename, recorder);
+            assert(parsed);
+
+            mismatches += count_event_file_mismatches(recorder.events, trace);
+
+            // Two scopes in top, eight declarations sharing seven codes.
+            if (recorder.scopes != 3 || recorder.upscopes != 3 || recorder.vars != 8 ||
+                recorder.enddefinitions != 1) {
+                mismatches++;
+            }
+
+            delete trace;
+        }
+    }
+
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Pull every event of a file with VCDEventReader
+ */
+void test_event_reader() {
+    std::cout << "\n=== Test 6: Event Reader Matches parse_file ===\n";
+
+    std::string filename = "modes_pull.vcd";
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 1000, 0);
+
+    VCDFile* plain = parse_with(filename, [](VCDFileParser&) {});
+    assert(plain != nullptr);
+
+    int mismatches = 0;
+
+    for (bool mapped : {true, false}) {
+        VCDEventReader reader;
+        reader.parser.use_mmap = mapped;
+
+        // Stop part way through, then read the same file again in full.
+        bool opened = reader.open(filename);
+        assert(opened);
+        VCDEvent event;
+        for (int i = 0; i < 100; ++i) {
+            bool read = reader.next(event);
+            assert(read);
+        }
+
+        opened = reader.open(filename);
+        assert(opened);
+        std::vector<RecordedEvent> events = read_events(reader);
+        assert(!reader.failed());
+        assert(!reader.next(event));
+
+        mismatches += count_event_file_mismatches(events, plain);
+        if (reader.get_header()->get_signal_id_count() != plain->get_signal_id_count()) {
+            mismatches++;
+        }
+
+        EventRecorder recorder;
+        VCDFileParser parser;
+        parser.use_mmap = mapped;
+        bool parsed = parser.parse_events(filename, recorder);
+        assert(parsed);
+        mismatches += count_event_mismatches(recorder.events, events);
+
+        reader.close();
+        assert(reader.get_header() == nullptr);
+    }
+
+    delete plain;
+    std::remove(filename.c_str());
+
+    // A malformed value change stops reading with an error.
+    filename = "modes_pull_bad.vcd";
+    std::ofstream out(filename, std::ios::binary);
+    out << "$scope module top $end\n$var wire 1 ! a $end\n$upscope $end\n";
+    out << "$enddefinitions $end\n#0\n1!\n#5\nq!\n#10\n0!\n";
+    out.close();
+
+    std::cout << "Reading a malformed file, one syntax error is expected:\n";
+
+    VCDEventReader reader;
+    bool opened = reader.open(filename);
+    assert(opened);
+    std::vector<RecordedEvent> events = read_events(reader);
+    std::remove(filename.c_str());
+
+    if (!reader.failed() || events.size() != 3) {
+        mismatches++;
+    }
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Read a whole file into a string
+ */
+std::string read_file(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    return contents.str();
+}
+
+#ifndef VCD_NO_ZLIB
+/*!
+ * @brief Write data as one gzip member, or append it as another
+ */
+void write_gzip(const std::string& filename, const std::string& data, bool append) {
+    gzFile out = gzopen(filename.c_str(), append ? "ab" : "wb");
+    assert(out != nullptr);
+    int written = gzwrite(out, data.data(), (unsigned)data.size());
+    assert(written == (int)data.size());
+    gzclose(out);
+}
+#endif
+
+/*!
+ * @brief Parse gzip compressed files
+ */
+void test_gzip_input() {
+    std::cout << "\n=== Test 7: Compressed Input ===\n";
+
+#ifdef VCD_NO_ZLIB
+    std::cout << "Skipped, built without zlib\n";
+#else
+    std::string filename = "modes_gzip.vcd";
+    generate_mixed_vcd(filename, 3000, 0);
+    std::string contents = read_file(filename);
+
+    VCDFile* plain = parse_with(filename, [](VCDFileParser&) {});
+    assert(plain != nullptr);
+
+    int mismatches = 0;
+
+    // Recognised by its contents, whatever the name.
+    std::string compressed = "modes_gzip_one.vcd";
+    write_gzip(compressed, contents, false);
+
+    // Concatenated members read as one stream.
+    std::string members = "modes_gzip_two.vcd.gz";
+    write_gzip(members, contents.substr(0, contents.size() / 2), false);
+    write_gzip(members, contents.substr(contents.size() / 2), true);
+
+    for (const std::string& name : {compressed, members}) {
+        for (unsigned blocks : {0u, 4u}) {
+            VCDFileParser parser;
+            parser.read_blocks = blocks;
+            VCDFile* trace = parser.parse_file(name);
+            assert(trace != nullptr);
+            mismatches += count_file_mismatches(plain, trace);
+            delete trace;
+        }
+    }
+
+    // Truncated data fails the parse.
+    std::string truncated = "modes_gzip_cut.vcd.gz";
+    std::string data = read_file(compressed);
+    std::ofstream out(truncated, std::ios::binary);
+    out.write(data.data(), data.size() * 2 / 3);
+    out.close();
+
+    std::cout << "Parsing a truncated file, one input error is expected:\n";
+    VCDFileParser parser;
+    VCDFile* trace = parser.parse_file(truncated);
+    if (trace != nullptr) {
+        mismatches++;
+        delete trace;
+    }
+
+    delete plain;
+    for (const std::string& name : {filename, compressed, members, truncated}) {
+        std::remove(name.c_str());
+    }
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+#endif
+}
+
+/*!
+ * @brief Parse files read as streams through the read ahead ring
+ */
+void test_stream_input() {
+    std::cout << "\n=== Test 8: Streamed Input ===\n";
+
+    std::string filename = "modes_stream.vcd";
+    generate_mixed_vcd(filename, 3000, 0);
+
+    VCDFile* plain = parse_with(filename, [](VCDFileParser&) {});
+    assert(plain != nullptr);
+
+    int mismatches = 0;
+    int checked = 0;
+
+    // Blocks much smaller than a value change split tokens between them.
+    for (size_t block_size : {(size_t)7, (size_t)4096, (size_t)(1 << 16)}) {
+        for (unsigned blocks : {0u, 1u, 2u, 8u}) {
+            VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) {
+                p.use_mmap = false;
+                p.read_block_size = block_size;
+                p.read_blocks = blocks;
+            });
+            assert(trace != nullptr);
+            mismatches += count_file_mismatches(plain, trace);
+            delete trace;
+            checked++;
+        }
+    }
+
+    delete plain;
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << checked << " configurations, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Parse value changes with the grammar rather than the body scanner
+ * @details Without $enddefinitions the grammar reads the whole file, and
+ * vector and real values reach it as slices of the scanned text.
+ */
+void test_grammar_values() {
+    std::cout << "\n=== Test 9: Value Changes Through The Grammar ===\n";
+
+    std::string filename = "modes_grammar.vcd";
+    generate_mixed_vcd(filename, 2000, 0);
+
+    VCDFile* plain = parse_with(filename, [](VCDFileParser&) {});
+    assert(plain != nullptr);
+
+    std::string contents = read_file(filename);
+    std::string marker = "$enddefinitions $end\n";
+    size_t at = contents.find(marker);
+    assert(at != std::string::npos);
+    contents.erase(at, marker.size());
+
+    std::string headerless = "modes_grammar_nodefs.vcd";
+    std::ofstream out(headerless, std::ios::binary);
+    out << contents;
+    out.close();
+
+    int mismatches = 0;
+
+    for (bool mapped : {true, false}) {
+        for (size_t block_size : {(size_t)5, (size_t)(1 << 16)}) {
+            VCDFile* trace = parse_with(headerless, [&](VCDFileParser& p) {
+                p.use_mmap = mapped;
+                p.read_block_size = block_size;
+            });
+            assert(trace != nullptr);
+            mismatches += count_file_mismatches(plain, trace);
+            delete trace;
+        }
+    }
+
+    delete plain;
+    std::remove(filename.c_str());
+    std::remove(headerless.c_str());
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Whether parse_real() gives exactly the double strtod() does
+ */
+bool parses_like_strtod(const std::string& text) {
+    VCDReal parsed = VCDFileParser::parse_real(text.data(), text.size());
+    double expected = std::strtod(text.c_str(), nullptr);
+    return std::memcmp(&parsed, &expected, sizeof(double)) == 0 ||
+           (std::isnan(parsed) && std::isnan(expected));
+}
+
+/*!
+ * @brief Convert real value text exactly and without the locale
+ */
+void test_parse_real() {
+    std::cout << "\n=== Test 10: Real Value Conversion ===\n";
+
+    std::vector<std::string> texts = {
+        "0", "-0", "+0.0", "1", "-1", "1.5", ".5", "5.", "-2.25e-3", "2.5E+2",
+        "3.14159265358979323846", "0.1", "0.3", "123456789012345678", "9007199254740993",
+        "1e22", "1e23", "1.7976931348623157e308", "1e309", "4.9e-324", "2e-324",
+        "2.2250738585072011e-308", "1234567890123456789012345e-10", "7e-10", "inf",
+        "-inf", "INF", "nan", "NaN", "00000000000000000000000001.5", "1.000000000000000000001"
+    };
+
+    // Random numbers of up to 25 digits, with and without fractions and exponents.
+    TestRandom rng(7);
+    for (int i = 0; i < 20000; ++i) {
+        std::string text = rng.below(2) ? "-" : "";
+        int digits = 1 + rng.below(25);
+        int point = rng.below(digits + 1);
+        for (int d = 0; d < digits; ++d) {
+            if (d == point) {
+                text += ".";
+            }
+            text += (char)('0' + rng.below(10));
+        }
+        if (rng.below(2)) {
+            text += "e" + std::to_string((int)rng.below(640) - 330);
+        }
+        texts.push_back(text);
+    }
+
+    int mismatches = 0;
+    for (const std::string& text : texts) {
+        if (!parses_like_strtod(text)) {
+            std::cerr << "Mismatch for " << text << "\n";
+            mismatches++;
+        }
+    }
+
+    // A locale with a decimal comma changes strtod() but not parse_real().
+    for (const char* name : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8"}) {
+        if (std::setlocale(LC_NUMERIC, name)) {
+            if (VCDFileParser::parse_real("1.5", 3) != 1.5) {
+                mismatches++;
+            }
+            std::setlocale(LC_NUMERIC, "C");
+            break;
+        }
+    }
+
+    std::cout << "Results: " << texts.size() << " numbers, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Whether every history of a file refers to a cache
+ */
+bool loaded_from_cache(VCDFile* trace) {
+    // Timestamps still in the mapping are copied by get_timestamps().
+    const VCDTime* mapped = trace->get_timestamp_view().data();
+    bool borrowed = trace->get_signal_id_count() > 0 &&
+                    mapped != trace->get_timestamps()->data();
+    for (size_t id = 0; id < trace->get_signal_id_count(); ++id) {
+        borrowed = borrowed && trace->get_signal_values((VCDSignalId)id)->is_borrowed();
+    }
+    return borrowed;
+}
+
+/*!
+ * @brief Save parsed files to a cache, load them back and notice stale caches
+ */
+void test_cache() {
+    std::cout << "\n=== Test 11: Cache Round Trip ===\n";
+
+    std::string filename = "modes_cache.vcd";
+    std::string cache = VCDFileCache::get_path(filename);
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 2000, 0);
+    std::remove(cache.c_str());
+
+    auto cached = [](VCDFileParser& p) { p.use_cache = true; };
+    int mismatches = 0;
+
+    VCDFile* plain = parse_with(filename, [](VCDFileParser&) {});
+    assert(plain != nullptr);
+
+    // The first parse writes the cache, the second loads it.
+    VCDFile* first = parse_with(filename, cached);
+    assert(first != nullptr && !loaded_from_cache(first));
+    assert(std::ifstream(cache).good());
+    VCDFile* second = parse_with(filename, cached);
+    assert(second != nullptr && loaded_from_cache(second));
+    mismatches += count_file_mismatches(plain, first);
+    mismatches += count_file_mismatches(plain, second);
+    if (second->get_signals()->size() != plain->get_signals()->size() ||
+        second->get_scopes()->size() != plain->get_scopes()->size() ||
+        second->date != plain->date || second->version != plain->version ||
+        second->time_units != plain->time_units) {
+        mismatches++;
+    }
+    delete first;
+    delete second;
+
+    // A window is parsed, never taken from the cache.
+    VCDFile* window = parse_with(filename, [&](VCDFileParser& p) {
+        p.use_cache = true;
+        p.start_time = times[1000];
+    });
+    assert(window != nullptr && !loaded_from_cache(window));
+    delete window;
+
+    // A truncated cache is ignored and written again.
+    std::string data = read_file(cache);
+    std::ofstream(cache, std::ios::binary).write(data.data(), data.size() / 2);
+    VCDFile* damaged = parse_with(filename, cached);
+    assert(damaged != nullptr && !loaded_from_cache(damaged));
+    mismatches += count_file_mismatches(plain, damaged);
+    delete damaged;
+    delete plain;
+
+    // Once the source changes its cache is out of date.
+    generate_mixed_vcd(filename, 2500, 0, 3);
+    plain = parse_with(filename, [](VCDFileParser&) {});
+    VCDFile* changed = parse_with(filename, cached);
+    assert(plain != nullptr && changed != nullptr && !loaded_from_cache(changed));
+    mismatches += count_file_mismatches(plain, changed);
+    delete changed;
+    VCDFile* reloaded = parse_with(filename, cached);
+    assert(reloaded != nullptr && loaded_from_cache(reloaded));
+    mismatches += count_file_mismatches(plain, reloaded);
+    delete reloaded;
+    delete plain;
+
+    std::remove(filename.c_str());
+    std::remove(cache.c_str());
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Number of differences between a window of a file and a full parse
+ * @details A window from start to end holds a timestamp at start and the
+ * timestamps of the full parse after it, up to end. Every signal has the
+ * same value at each of them as in the full parse. Nothing is kept when
+ * there is no marker at or after start, or start is past end.
+ */
+int count_window_mismatches(VCDFile* full, VCDFile* window, VCDTime start, VCDTime end) {
+    const std::vector<VCDTime>& all = *full->get_timestamps();
+    std::vector<VCDTime> expected;
+
+    if (start <= end && !all.empty() && all.back() >= start) {
+        expected.push_back(start);
+        for (VCDTime time : all) {
+            if (time > start && time <= end) {
+                expected.push_back(time);
+            }
+        }
+    }
+
+    int mismatches = *window->get_timestamps() == expected ? 0 : 1;
+
+    for (size_t id = 0; id < full->get_signal_id_count(); ++id) {
+        if (expected.empty() && !window->get_signal_values((VCDSignalId)id)->empty()) {
+            mismatches++;
+        }
+        for (VCDTime time : expected) {
+            VCDValue a, b;
+            bool has_a = full->get_signal_value_at((VCDSignalId)id, time, a);
+            bool has_b = window->get_signal_value_at((VCDSignalId)id, time, b);
+            if (has_a != has_b || (has_a && !same_value(a, b))) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+/*!
+ * @brief Start windowed parses from the checkpoints of an index
+ */
+void test_index() {
+    std::cout << "\n=== Test 12: Seeking With An Index ===\n";
+
+    std::string filename = "modes_index.vcd";
+    std::string index_path = VCDFileIndex::get_path(filename);
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 5000, 0);
+
+    bool built = VCDFileIndex::build(filename, index_path, 64);
+    assert(built);
+
+    VCDFileIndex index;
+    VCDFileCache::Source source;
+    bool loaded = VCDFileCache::get_source(filename, source) && index.load(index_path, source);
+    assert(loaded && index.get_checkpoints().size() == 5000 / 64);
+
+    VCDFile* full = parse_with(filename, [](VCDFileParser&) {});
+    assert(full != nullptr);
+
+    // Before the first checkpoint, on checkpoints, between them and past the end.
+    std::vector<VCDTime> starts = {1, times[63], times[64] + 1, times[1000],
+                                   times[2047] + 1, times[4999], times.back() + 1};
+    for (const VCDFileIndex::Checkpoint& checkpoint : index.get_checkpoints()) {
+        starts.push_back(checkpoint.time);
+    }
+    int mismatches = 0;
+
+    for (VCDTime start : starts) {
+        for (VCDTime end : {times.back(), times[3000]}) {
+            VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) {
+                p.use_index = true;
+                p.use_dumps = false;
+                p.start_time = start;
+                p.end_time = end;
+            });
+            assert(trace != nullptr);
+            mismatches += count_window_mismatches(full, trace, start, end);
+            delete trace;
+        }
+    }
+
+    // Once the file changes the index is out of date and ignored.
+    delete full;
+    times = generate_mixed_vcd(filename, 4000, 0, 5);
+    loaded = VCDFileCache::get_source(filename, source) && index.load(index_path, source);
+    assert(!loaded);
+
+    full = parse_with(filename, [](VCDFileParser&) {});
+    VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) {
+        p.use_index = true;
+        p.start_time = times[2000];
+    });
+    assert(full != nullptr && trace != nullptr);
+    mismatches += count_window_mismatches(full, trace, times[2000],
+                                          std::numeric_limits<VCDTime>::max());
+    delete trace;
+    delete full;
+
+    std::remove(filename.c_str());
+    std::remove(index_path.c_str());
+
+    std::cout << "Results: " << starts.size() * 2 << " windows, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Start windowed parses at the last dump block before start_time
+ */
+void test_dump_seek() {
+    std::cout << "\n=== Test 13: Seeking To Dump Blocks ===\n";
+
+    std::string filename = "modes_dumps.vcd";
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 3000, 100);
+
+    VCDFile* full = parse_with(filename, [](VCDFileParser&) {});
+    assert(full != nullptr);
+
+    // On, just after and just before $dumpall markers, and elsewhere.
+    std::vector<VCDTime> starts = {0, 1, times[99], times[100], times[100] + 1,
+                                   times[1550], times[2999], times[3000], times.back() + 1};
+    int mismatches = 0;
+    int checked = 0;
+
+    for (VCDTime start : starts) {
+        for (bool dumps : {true, false}) {
+            for (bool mapped : {true, false}) {
+                VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) {
+                    p.use_dumps = dumps;
+                    p.use_mmap = mapped;
+                    p.start_time = start;
+                });
+                assert(trace != nullptr);
+                mismatches += count_window_mismatches(full, trace, start,
+                                                      std::numeric_limits<VCDTime>::max());
+                delete trace;
+                checked++;
+            }
+        }
+    }
+
+    delete full;
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << checked << " windows, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Load histories on first access and evict the least recently used
+ */
+void test_lazy_loading() {
+    std::cout << "\n=== Test 14: Lazy Loading ===\n";
+
+    // Large enough for several chunks of VCDSignalLoader::CHUNK_SIZE.
+    std::string filename = "modes_lazy.vcd";
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 150000, 0);
+
+    VCDFile* plain = parse_with(filename, [](VCDFileParser&) {});
+    assert(plain != nullptr);
+
+    int mismatches = 0;
+
+    VCDFileParser parser;
+    parser.lazy_capacity = 2;
+    VCDFile* lazy = parser.parse_lazy(filename);
+    assert(lazy != nullptr);
+    mismatches += count_file_mismatches(plain, lazy);
+
+    // Loading a third history empties the least recently used one.
+    VCDSignalValues* first = lazy->get_signal_values((VCDSignalId)0);
+    lazy->get_signal_values((VCDSignalId)1);
+    lazy->get_signal_values((VCDSignalId)0);
+    lazy->get_signal_values((VCDSignalId)2);
+    if (first->empty()) {
+        mismatches++;
+    }
+    lazy->get_signal_values((VCDSignalId)1);
+    if (!first->empty() || lazy->get_signal_values((VCDSignalId)0) != first) {
+        mismatches++;
+    }
+    mismatches += count_history_mismatches(plain->get_signal_values((VCDSignalId)0), first);
+
+    // A batch larger than the capacity is loaded whole.
+    std::vector<VCDSignalId> ids;
+    for (size_t id = 0; id < lazy->get_signal_id_count(); ++id) {
+        ids.push_back((VCDSignalId)id);
+    }
+    lazy->load_signal_values(ids);
+    for (VCDSignalId id : ids) {
+        const VCDFile* loaded = lazy;
+        mismatches += count_history_mismatches(plain->get_signal_values(id),
+                                               loaded->get_signal_values(id));
+    }
+    delete lazy;
+
+    // Windows and selections apply as for parse_file.
+    for (VCDTime start : {times[0], times[70000], times[70000] + 1}) {
+        auto window = [&](VCDFileParser& p) {
+            p.start_time = start;
+            p.end_time = times[120000];
+            p.select("top.mem");
+        };
+        VCDFile* trace = parse_with(filename, window);
+        VCDFileParser lazy_parser;
+        window(lazy_parser);
+        lazy_parser.lazy_capacity = 3;
+        lazy = lazy_parser.parse_lazy(filename);
+        assert(trace != nullptr && lazy != nullptr);
+        mismatches += count_file_mismatches(trace, lazy);
+        delete trace;
+        delete lazy;
+    }
+
+    delete plain;
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Skip the value changes before start_time in every parse mode
+ */
+void test_start_time() {
+    std::cout << "\n=== Test 15: Skipping To start_time ===\n";
+
+    std::string filename = "modes_start.vcd";
+    std::vector<VCDTime> times = generate_mixed_vcd(filename, 20000, 0);
+
+    VCDFile* full = parse_with(filename, [](VCDFileParser&) {});
+    assert(full != nullptr);
+
+    std::vector<VCDTime> starts = {1, times[0] + 1, times[5000], times[5000] + 1,
+                                   times[19999], times.back() + 1};
+    int mismatches = 0;
+    int checked = 0;
+
+    for (VCDTime start : starts) {
+        for (VCDTime end : {times.back(), times[12000]}) {
+            // Mapped, streamed, and mapped on several threads.
+            for (int mode = 0; mode < 3; ++mode) {
+                VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) {
+                    p.use_dumps = false;
+                    p.use_mmap = mode != 1;
+                    p.threads = mode == 2 ? 4 : 1;
+                    p.start_time = start;
+                    p.end_time = end;
+                });
+                assert(trace != nullptr);
+                mismatches += count_window_mismatches(full, trace, start, end);
+                delete trace;
+                checked++;
+            }
+        }
+    }
+    delete full;
+
+    // Reals after the last binary value of a signal are dropped, not kept.
+    std::ofstream out(filename);
+    out << "$timescale 1ns $end\n"
+        << "$scope module top $end\n"
+        << "$var wire 1 ! clk $end\n"
+        << "$var wire 4 \" bus [3:0] $end\n"
+        << "$upscope $end\n"
+        << "$enddefinitions $end\n"
+        << "#0\n1!\nb1010 \"\n"
+        << "#5\nr1.5 !\nr2.5 \"\n"
+        << "#20\n0!\n";
+    out.close();
+
+    full = parse_with(filename, [](VCDFileParser&) {});
+    assert(full != nullptr);
+    for (bool mapped : {true, false}) {
+        VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) {
+            p.use_mmap = mapped;
+            p.start_time = 10;
+        });
+        assert(trace != nullptr);
+        mismatches += count_window_mismatches(full, trace, 10,
+                                              std::numeric_limits<VCDTime>::max());
+        VCDValue clk, bus;
+        bool found = trace->get_signal_value_at((VCDSignalId)0, 10, clk) &&
+                     trace->get_signal_value_at((VCDSignalId)1, 10, bus);
+        if (!found || clk.get_value_bit() != VCD_1 || bus.get_type() != VCD_VECTOR || bus.get_value_words()[0] != 10) {
+            mismatches++;
+        }
+        delete trace;
+        checked++;
+    }
+    delete full;
+
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << checked << " windows, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Read only the declarations of a file, up to $enddefinitions
+ */
+void test_parse_header() {
+    std::cout << "\n=== Test 16: Parsing The Header Only ===\n";
+
+    std::string filename = "modes_header.vcd";
+    generate_mixed_vcd(filename, 2000, 0);
+
+    VCDFile* full = parse_with(filename, [](VCDFileParser&) {});
+    assert(full != nullptr);
+
+    std::vector<VCDScope*>& scopes = *full->get_scopes();
+    std::vector<VCDSignal*>& signals = *full->get_signals();
+    int mismatches = 0;
+
+    for (bool mapped : {true, false}) {
+        VCDFileParser parser;
+        parser.use_mmap = mapped;
+        VCDFile* header = parser.parse_header(filename);
+        assert(header != nullptr);
+
+        // The same declarations, in the same order.
+        std::vector<VCDScope*>& header_scopes = *header->get_scopes();
+        if (header_scopes.size() != scopes.size()) {
+            mismatches++;
+        }
+        for (size_t i = 0; i < scopes.size() && i < header_scopes.size(); ++i) {
+            const VCDScope* a = scopes[i];
+            const VCDScope* b = header_scopes[i];
+            if (a->name != b->name || a->type != b->type ||
+                a->children.size() != b->children.size() ||
+                a->signals.size() != b->signals.size() ||
+                (a->parent == nullptr) != (b->parent == nullptr) ||
+                (a->parent && a->parent->name != b->parent->name)) {
+                mismatches++;
+            }
+        }
+
+        std::vector<VCDSignal*>& header_signals = *header->get_signals();
+        if (header_signals.size() != signals.size() ||
+            header->get_signal_id_count() != full->get_signal_id_count()) {
+            mismatches++;
+        }
+        for (size_t i = 0; i < signals.size() && i < header_signals.size(); ++i) {
+            const VCDSignal* a = signals[i];
+            const VCDSignal* b = header_signals[i];
+            if (a->hash != b->hash || a->id != b->id || a->reference != b->reference ||
+                a->size != b->size || a->type != b->type || a->lindex != b->lindex ||
+                a->rindex != b->rindex || a->scope->name != b->scope->name) {
+                mismatches++;
+            }
+        }
+
+        if (header->time_units != full->time_units ||
+            header->time_resolution != full->time_resolution) {
+            mismatches++;
+        }
+
+        // No value changes are read.
+        if (!header->get_timestamp_view().empty() || !header->get_timestamps()->empty()) {
+            mismatches++;
+        }
+        for (size_t id = 0; id < header->get_signal_id_count(); ++id) {
+            if (!header->get_signal_values((VCDSignalId)id)->empty()) {
+                mismatches++;
+            }
+        }
+
+        delete header;
+    }
+
+    std::cout << "Results: " << signals.size() << " signals, " << mismatches << " mismatches\n";
+
+    delete full;
+    std::remove(filename.c_str());
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Look up many times at once, against one lookup per time
+ */
+void test_values_at() {
+    std::cout << "\n=== Test 17: Values At Many Times ===\n";
+
+    std::string filename = "modes_values_at.vcd";
+    std::vector<VCDTime> markers = generate_mixed_vcd(filename, 3000, 0);
+
+    VCDFile* trace = parse_with(filename, [](VCDFileParser&) {});
+    assert(trace != nullptr);
+
+    int mismatches = 0;
+    size_t queries = 0;
+
+    for (size_t id = 0; id < trace->get_signal_id_count(); ++id) {
+        const VCDSignalValues* history = trace->get_signal_values((VCDSignalId)id);
+        VCDSpan<VCDTime> changes = history->get_times();
+
+        // Before the first change, on and between changes, repeated, and past the end.
+        std::vector<VCDTime> times = {0, 0};
+        if (!changes.empty() && changes[0] > 0) {
+            times.push_back(changes[0] - 1);
+        }
+        for (size_t i = 0; i < changes.size(); i += 7) {
+            times.push_back(changes[i]);
+            times.push_back(changes[i]);
+            times.push_back(changes[i] + 1);
+        }
+        times.push_back(markers.back());
+        times.push_back(markers.back() + 1000);
+        times.push_back(markers.back() + 1000);
+        std::sort(times.begin(), times.end());
+
+        std::vector<VCDValue> values;
+        size_t missing = trace->get_signal_values_at((VCDSignalId)id, times, values);
+
+        size_t expected_missing = 0;
+        if (values.size() != times.size()) {
+            mismatches++;
+            continue;
+        }
+        for (size_t i = 0; i < times.size(); ++i) {
+            VCDValue value;
+            if (trace->get_signal_value_at((VCDSignalId)id, times[i], value)) {
+                if (!same_value(value, values[i])) {
+                    mismatches++;
+                }
+            } else {
+                expected_missing++;
+            }
+        }
+        if (missing != expected_missing) {
+            mismatches++;
+        }
+        queries += times.size();
+    }
+
+    // An unknown signal has no value at any time.
+    std::vector<VCDValue> values;
+    std::vector<VCDTime> times = {0, markers.back()};
+    if (trace->get_signal_values_at(VCD_SIGNAL_ID_NONE, times, values) != times.size()) {
+        mismatches++;
+    }
+
+    delete trace;
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << queries << " queries, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Keep timestamps past 32 bits, and convert them with every timescale
+ */
+void test_wide_times() {
+    std::cout << "\n=== Test 18: Wide Timestamps And Timescales ===\n";
+
+    std::string filename = "modes_wide_times.vcd";
+    std::vector<VCDTime> expected = {0, 2147483647ULL, 2147483648ULL, 4294967296ULL,
+                                     4294967297ULL, 8589934592123ULL, 1ULL << 62};
+    int mismatches = 0;
+
+    std::ofstream out(filename, std::ios::binary);
+    out << "$timescale 100 fs $end\n"
+        << "$scope module top $end\n"
+        << "$var wire 1 ! clk $end\n"
+        << "$var wire 8 \" count [7:0] $end\n"
+        << "$upscope $end\n"
+        << "$enddefinitions $end\n";
+    for (size_t i = 0; i < expected.size(); ++i) {
+        out << "#" << expected[i] << "\n" << (i & 1) << "!\nb";
+        for (int bit = 7; bit >= 0; --bit) {
+            out << ((i >> bit) & 1);
+        }
+        out << " \"\n";
+    }
+    out.close();
+
+    for (bool mapped : {true, false}) {
+        VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) { p.use_mmap = mapped; });
+        assert(trace != nullptr);
+
+        if (*trace->get_timestamps() != expected || trace->time_units != TIME_FS ||
+            trace->time_resolution != 100) {
+            mismatches++;
+        }
+        for (size_t i = 0; i < expected.size(); ++i) {
+            VCDValue clk, count;
+            bool found = trace->get_signal_value_at(trace->get_signal_id("!"), expected[i], clk) &&
+                         trace->get_signal_value_at(trace->get_signal_id("\""), expected[i], count);
+            if (!found || clk.get_value_bit() != ((i & 1) ? VCD_1 : VCD_0) ||
+                count.get_value_words()[0] != i) {
+                mismatches++;
+            }
+        }
+
+        // 2^32 ticks of 100 fs.
+        double seconds = trace->get_time_seconds(4294967296ULL);
+        if (std::fabs(seconds - 4294967296.0 * 100e-15) > 1e-12 * seconds) {
+            mismatches++;
+        }
+        delete trace;
+    }
+
+    // Without $enddefinitions the grammar reads the timestamps instead.
+    std::string text = read_file(filename);
+    std::string marker = "$enddefinitions $end\n";
+    text.erase(text.find(marker), marker.size());
+    std::ofstream(filename, std::ios::binary) << text;
+    VCDFile* grammar = parse_with(filename, [](VCDFileParser&) {});
+    assert(grammar != nullptr);
+    if (*grammar->get_timestamps() != expected) {
+        mismatches++;
+    }
+    delete grammar;
+    std::ofstream(filename, std::ios::binary) << text.insert(text.find("#0"), marker);
+
+    // A window starting past 32 bits.
+    VCDFile* window = parse_with(filename, [&](VCDFileParser& p) { p.start_time = 4294967296ULL; });
+    std::vector<VCDTime> tail(expected.begin() + 3, expected.end());
+    assert(window != nullptr);
+    if (*window->get_timestamps() != tail) {
+        mismatches++;
+    }
+    delete window;
+
+    // Every unit, with a multiplier.
+    struct { const char* unit; VCDTimeUnit value; double seconds; } units[] = {
+        {"s", TIME_S, 1e0}, {"ms", TIME_MS, 1e-3}, {"us", TIME_US, 1e-6},
+        {"ns", TIME_NS, 1e-9}, {"ps", TIME_PS, 1e-12}, {"fs", TIME_FS, 1e-15},
+    };
+    for (const auto& unit : units) {
+        std::ofstream scaled(filename, std::ios::binary);
+        scaled << "$timescale 10" << unit.unit << " $end\n"
+               << "$scope module top $end\n$var wire 1 ! clk $end\n$upscope $end\n"
+               << "$enddefinitions $end\n#0\n1!\n";
+        scaled.close();
+
+        VCDFile* trace = parse_with(filename, [](VCDFileParser&) {});
+        assert(trace != nullptr);
+        double seconds = trace->get_time_seconds(1500);
+        if (trace->time_units != unit.value || trace->time_resolution != 10 ||
+            std::fabs(seconds - 15000 * unit.seconds) > 1e-12 * seconds) {
+            mismatches++;
+        }
+        delete trace;
+    }
+
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+/*!
+ * @brief Map identifier codes of every length and size of key onto signals
+ */
+void test_id_codes() {
+    std::cout << "\n=== Test 19: Identifier Codes ===\n";
+
+    std::string filename = "modes_id_codes.vcd";
+
+    // Small keys in the flat array, large ones in the integer map, and
+    // codes too long to decode in the string map.
+    std::vector<std::string> codes = {"!", "~", "!!", "~~~~", "}~~~~~~~~",
+                                      "~~~~~~~~~", "abcdefghij", "0123456789ABCDEF",
+                                      "#", "~~~~~~~~~~", "\"~"};
+    const int steps = 50;
+    int mismatches = 0;
+
+    std::ofstream out(filename, std::ios::binary);
+    out << "$timescale 1ns $end\n$scope module top $end\n";
+    for (size_t i = 0; i < codes.size(); ++i) {
+        out << "$var wire 1 " << codes[i] << " s" << i << " $end\n";
+    }
+    // A second name for a long code shares its history.
+    out << "$var wire 1 abcdefghij alias $end\n";
+    out << "$upscope $end\n$enddefinitions $end\n";
+    for (int t = 0; t < steps; ++t) {
+        out << "#" << t * 10 << "\n";
+        for (size_t i = 0; i < codes.size(); ++i) {
+            // Each signal toggles with its own period.
+            if (t % (i + 1) == 0) {
+                out << ((t / (i + 1)) & 1) << codes[i] << "\n";
+            }
+        }
+    }
+    out.close();
+
+    for (bool mapped : {true, false}) {
+        VCDFile* trace = parse_with(filename, [&](VCDFileParser& p) { p.use_mmap = mapped; });
+        assert(trace != nullptr);
+
+        std::vector<VCDSignalId> ids;
+        for (size_t i = 0; i < codes.size(); ++i) {
+            VCDSignalId id = trace->get_signal_id(codes[i]);
+            if (id == VCD_SIGNAL_ID_NONE || std::find(ids.begin(), ids.end(), id) != ids.end()) {
+                mismatches++;
+                continue;
+            }
+            ids.push_back(id);
+
+            const VCDSignalValues* history = trace->get_signal_values(id);
+            size_t expected = (steps + i) / (i + 1);
+            if (history->size() != expected) {
+                mismatches++;
+                continue;
+            }
+            for (size_t n = 0; n < expected; ++n) {
+                VCDBit bit = (n & 1) ? VCD_1 : VCD_0;
+                if (history->get_times()[n] != (VCDTime)(n * (i + 1) * 10) ||
+                    history->get_value(n).get_value_bit() != bit) {
+                    mismatches++;
+                }
+            }
+        }
+
+        // Unknown codes, including ones one character longer.
+        if (trace->get_signal_id("abcdefghijk") != VCD_SIGNAL_ID_NONE ||
+            trace->get_signal_id("}") != VCD_SIGNAL_ID_NONE ||
+            trace->get_signal_id("~~~~~~~~~~~") != VCD_SIGNAL_ID_NONE) {
+            mismatches++;
+        }
+
+        size_t aliases = 0;
+        for (VCDSignal* signal : *trace->get_signals()) {
+            aliases += signal->hash == "abcdefghij" && signal->id == trace->get_signal_id("abcdefghij");
+        }
+        if (aliases != 2) {
+            mismatches++;
+        }
+        delete trace;
+    }
+
+    std::remove(filename.c_str());
+
+    std::cout << "Results: " << codes.size() << " codes, " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
+int main(int argc, char** argv) {
+    std::cout << "======================================\n";
+    std::cout << "VCD Parser Parse Mode Test Suite\n";
+    std::cout << "======================================\n";
+
+    try {
+        test_reader_start_time();
+        test_body_scanner();
+        test_parallel_parse();
+        test_selection();
+        test_event_handler();
+        test_event_reader();
+        test_gzip_input();
+        test_stream_input();
+        test_grammar_values();
+        test_parse_real();
+        test_cache();
+        test_index();
+        test_dump_seek();
+        test_lazy_loading();
+        test_start_time();
+        test_parse_header();
+        test_values_at();
+        test_wide_times();
+        test_id_codes();
+
+        std::cout << "\n======================================\n";
+        std::cout << "All tests PASSED!\n";
+        std::cout << "======================================\n";
+
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\nFATAL ERROR: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -7,6 +7,7 @@ in separate threads.
 */
 
 #include "VCDFileParser.hpp"
+#include "VCDSignalCursor.hpp"
 #include <thread>
 #include <vector>
 #include <iostream>
@@ -301,6 +302,57 @@ void test_sequential_reuse() {
     assert(failed == 0);
 }
 
+/*!
+ * @brief Scan every signal of one shared parsed file from many threads
+ */
+void test_concurrent_cursors() {
+    std::cout << "\n=== Test 5: Concurrent Cursors Over One File ===\n";
+
+    const int num_threads = 8;
+    const int num_signals = 16;
+    const int num_timestamps = 200;
+    std::string filename = "cursor_test.vcd";
+
+    generate_test_vcd(filename, num_signals, num_timestamps);
+
+    VCDFileParser parser;
+    VCDFile* trace = parser.parse_file(filename);
+    std::remove(filename.c_str());
+    assert(trace != nullptr);
+
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&]() {
+            for (VCDSignal* signal : *trace->get_signals()) {
+                // Signals are named sig<index>.
+                int index = std::atoi(signal->reference.c_str() + 3);
+                VCDSignalCursor cursor(trace->get_signal_values(signal->id));
+
+                // Every signal toggles at every timestamp after $dumpvars.
+                for (int t = 0; t < num_timestamps; ++t) {
+                    VCDBit expected = ((t + index) % 2 == 0) ? VCD_1 : VCD_0;
+                    if (!cursor.advance_to(t * 10) ||
+                        cursor.get_value().get_value_bit() != expected) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    delete trace;
+
+    std::cout << "Results: " << mismatches << " mismatches\n";
+
+    assert(mismatches == 0);
+}
+
 int main(int argc, char** argv) {
     std::cout << "======================================\n";
     std::cout << "VCD Parser Multithreading Test Suite\n";
@@ -311,6 +363,7 @@ int main(int argc, char** argv) {
         test_stress_many_threads();
         test_variable_sizes();
         test_sequential_reuse();
+        test_concurrent_cursors();
 
         std::cout << "\n======================================\n";
         std::cout << "All tests PASSED!\n";
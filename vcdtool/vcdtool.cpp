@@ -1,12 +1,17 @@
 
+#include <fstream>
+
 #include "VCDFileParser.hpp"
+#include "VCDFileIndex.hpp"
 #include "cxxopts.hpp"
 #include "gitversion.h"
 
-void print_scope_signals(VCDFile * trace, VCDScope * scope, std::string local_parent)
+void print_scope_signals(const VCDFileParser & parser, VCDFile * trace, VCDScope * scope, std::string local_parent)
 {
     for(VCDSignal * signal : scope -> signals) {
-        std::cout << signal -> hash << "\t" << trace->get_signal_values(signal -> hash)->size() << "\t"
+        if (!parser.is_selected(signal -> id))
+            continue;
+        std::cout << signal -> hash << "\t" << trace->get_signal_values(signal -> id)->size() << "\t"
                     << local_parent << "." << signal -> reference;
 
         if(signal -> size > 1) {
@@ -20,7 +25,7 @@ void print_scope_signals(VCDFile * trace, VCDScope * scope, std::string local_pa
     }
 }
 
-void traverse_scope(std::string parent, VCDFile * trace, VCDScope * scope, bool instances, bool fullpath)
+void traverse_scope(const VCDFileParser & parser, std::string parent, VCDFile * trace, VCDScope * scope, bool instances, bool fullpath)
 {
     std::string local_parent = parent;
 
@@ -30,9 +35,9 @@ void traverse_scope(std::string parent, VCDFile * trace, VCDScope * scope, bool
     if (instances)
         std::cout << "Scope: " << local_parent  << std::endl;
     if (fullpath)
-        print_scope_signals(trace, scope, local_parent);
+        print_scope_signals(parser, trace, scope, local_parent);
     for (auto child : scope->children)
-        traverse_scope(local_parent, trace, child, instances, fullpath);
+        traverse_scope(parser, local_parent, trace, child, instances, fullpath);
 }
 /*!
 @brief Standalone test function to allow testing of the VCD file parser.
@@ -50,6 +55,9 @@ int main (int argc, char** argv)
         ("s,start", "Start time (default to 0)", cxxopts::value<VCDTime>())
         ("e,end", "End time (default to end of file)", cxxopts::value<VCDTime>())
         ("f,file", "filename containing scopes and signal name regex", cxxopts::value<std::string>())
+        ("c,cache", "Load the trace from, or save it to, a cache next to the file")
+        ("x,index", "Seek to the start time with an index next to the file, building it first if needed")
+        ("d,dumps", "Seek to the last $dumpall before the start time, for files whose dump blocks list every signal")
         ("positional", "Positional pareameters", cxxopts::value<std::vector<std::string>>())
     ;
     options.parse_positional({"positional"});
@@ -70,10 +78,54 @@ int main (int argc, char** argv)
     if (result.count("end"))
         parser.end_time = result["end"].as<VCDTime>();
 
-    VCDFile * trace = parser.parse_file(infile);
+    parser.use_cache = result["cache"].as<bool>();
+    parser.use_dumps = result["dumps"].as<bool>();
+
+    if (result["index"].as<bool>()) {
+        VCDFileIndex index;
+        VCDFileCache::Source source;
+        std::string index_path = VCDFileIndex::get_path(infile);
+
+        if (VCDFileCache::get_source(infile, source) &&
+            !index.load(index_path, source) &&
+            !VCDFileIndex::build(infile, index_path))
+            std::cerr << "Cannot index " << infile << std::endl;
+
+        parser.use_index = true;
+    }
+
+    // One scope or signal path regex per line, blank lines are ignored.
+    if (result.count("file")) {
+        std::ifstream select_file(result["file"].as<std::string>());
+        if (!select_file) {
+            std::cerr << "Cannot open " << result["file"].as<std::string>() << std::endl;
+            return 1;
+        }
+        std::string line;
+        while (std::getline(select_file, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (line.empty())
+                continue;
+            try {
+                parser.select_pattern(line);
+            } catch (const std::regex_error & e) {
+                std::cerr << "Bad regex '" << line << "': " << e.what() << std::endl;
+                return 1;
+            }
+        }
+    }
+
     bool instances = result["instances"].as<bool>();
     bool fullpath = result["fullpath"].as<bool>();
 
+    // Listing instances needs nothing after $enddefinitions.
+    VCDFile * trace;
+    if (instances && !fullpath && !result["header"].as<bool>())
+        trace = parser.parse_header(infile);
+    else
+        trace = parser.parse_file(infile);
+
     if (trace) {
         if (result["header"].as<bool>()) {
             std::cout << "Version:       " << trace -> version << std::endl;
@@ -85,7 +137,7 @@ int main (int argc, char** argv)
                 std::cout << "Hash\tToggles\tFull signal path\n";
         }    
         // Print out every signal in every scope.
-        traverse_scope(std::string(""), trace, trace->root_scope, instances, fullpath);
+        traverse_scope(parser, std::string(""), trace, trace->root_scope, instances, fullpath);
 
         delete trace;
         